@@ -0,0 +1,221 @@
+#include <cstddef>  // std::size_t
+#include <random>   // std::mt19937, std::uniform_int_distribution
+#include <vector>   // std::vector
+
+#include "benchmark/benchmark.h"
+#include "priority_queue/BinaryHeap.h"
+#include "priority_queue/IndexedPriorityQueue.h"
+#include "priority_queue/KHeap.h"
+#include "priority_queue/PriorityQueue.h"
+
+namespace {
+
+    // deterministic pseudo-random keys, so every run measures the same work
+    std::vector<int> make_keys(const std::size_t n) {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int> distribution(0, 1 << 30);
+
+        std::vector<int> keys(n);
+        for (auto& key : keys) {
+            key = distribution(generator);
+        }
+
+        return keys;
+    }
+
+    // element with a configurable payload, ordered by key only. Used to measure how much
+    // of the sift cost is dragging the payload through the cache.
+    template <std::size_t PayloadBytes>
+    struct record_t {
+        int key;
+        char payload[PayloadBytes];
+    };
+
+    template <std::size_t PayloadBytes>
+    struct record_greater_t {
+        [[nodiscard]] bool operator()(const record_t<PayloadBytes>& a,
+                                      const record_t<PayloadBytes>& b) const noexcept {
+            return a.key > b.key;
+        }
+    };
+
+    /////////////////
+    // push-heavy
+    /////////////////
+
+    void BM_BinaryHeapPush(benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto keys = make_keys(n);
+
+        for (auto _ : state) {
+            auto min_heap = heap::make_min_heap<false, int>();
+            for (const auto key : keys) {
+                min_heap.push(key);
+            }
+            benchmark::DoNotOptimize(min_heap.top());
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+    }
+
+    template <std::size_t K>
+    void BM_KHeapPush(benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto keys = make_keys(n);
+
+        for (auto _ : state) {
+            auto min_heap = heap::make_min_k_heap<K, false, int>();
+            for (const auto key : keys) {
+                min_heap.push(key);
+            }
+            benchmark::DoNotOptimize(min_heap.top());
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+    }
+
+    /////////////////
+    // pop-heavy (build once with Floyd, then drain)
+    /////////////////
+
+    void BM_BinaryHeapDrain(benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto keys = make_keys(n);
+
+        for (auto _ : state) {
+            auto min_heap = heap::make_min_heap(keys);
+            while (!min_heap.empty()) {
+                benchmark::DoNotOptimize(min_heap.pop_top());
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+    }
+
+    template <std::size_t K>
+    void BM_KHeapDrain(benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto keys = make_keys(n);
+
+        for (auto _ : state) {
+            auto min_heap = heap::make_min_k_heap<K>(keys);
+            while (!min_heap.empty()) {
+                benchmark::DoNotOptimize(min_heap.pop_top());
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+    }
+
+    /////////////////
+    // payload size: drain a heap of fat records ordered by key
+    /////////////////
+
+    template <std::size_t PayloadBytes>
+    void BM_BinaryHeapDrainPayload(benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto keys = make_keys(n);
+
+        std::vector<record_t<PayloadBytes>> records(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            records[i].key = keys[i];
+        }
+
+        for (auto _ : state) {
+            heap::BinaryHeap<record_t<PayloadBytes>, false, record_greater_t<PayloadBytes>>
+                min_heap(records, record_greater_t<PayloadBytes>{});
+            while (!min_heap.empty()) {
+                benchmark::DoNotOptimize(min_heap.top().key);
+                min_heap.pop();
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+        state.counters["payload_bytes"] = PayloadBytes;
+    }
+
+    /////////////////
+    // decrease-key heavy: Dijkstra-like replay over the priority queue front ends
+    /////////////////
+
+    void BM_PriorityQueueDijkstraReplay(benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto keys = make_keys(n);
+
+        std::vector<int> elements(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            elements[i] = static_cast<int>(i);
+        }
+
+        // each popped vertex "relaxes" a handful of pseudo-edges
+        std::mt19937 generator(1234);
+        std::uniform_int_distribution<int> vertex_distribution(0, static_cast<int>(n) - 1);
+
+        for (auto _ : state) {
+            auto pq = priority_queue::make_min_priority_queue(keys, elements);
+            std::int64_t updates = 0;
+            while (!pq.empty()) {
+                const auto [key, vertex] = pq.pop_top();
+                benchmark::DoNotOptimize(vertex);
+                for (int edge = 0; edge < 4; ++edge) {
+                    const int neighbor = vertex_distribution(generator);
+                    if (pq.contains(neighbor) && pq.key_at(neighbor) > key + edge) {
+                        pq.update_key(key + edge, neighbor);
+                        ++updates;
+                    }
+                }
+            }
+            state.counters["decrease_keys"] += static_cast<double>(updates);
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+    }
+
+    void BM_IndexedPriorityQueueDijkstraReplay(benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto keys = make_keys(n);
+
+        std::vector<int> elements(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            elements[i] = static_cast<int>(i);
+        }
+
+        std::mt19937 generator(1234);
+        std::uniform_int_distribution<int> vertex_distribution(0, static_cast<int>(n) - 1);
+
+        for (auto _ : state) {
+            auto pq = priority_queue::make_min_indexed_priority_queue(keys, elements);
+            while (!pq.empty()) {
+                const auto [key, vertex] = pq.pop_top();
+                benchmark::DoNotOptimize(vertex);
+                for (int edge = 0; edge < 4; ++edge) {
+                    const int neighbor = vertex_distribution(generator);
+                    if (pq.contains(neighbor) && pq.key_at(neighbor) > key + edge) {
+                        pq.update_key(key + edge, neighbor);
+                    }
+                }
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+    }
+
+}  // namespace
+
+// element counts from 1e3 to ~1e7; bump the upper bound to 1e8 for soak runs
+BENCHMARK(BM_BinaryHeapPush)->RangeMultiplier(64)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_KHeapPush, 4)->RangeMultiplier(64)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_KHeapPush, 8)->RangeMultiplier(64)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_KHeapPush, 16)->RangeMultiplier(64)->Range(1 << 10, 1 << 24);
+
+BENCHMARK(BM_BinaryHeapDrain)->RangeMultiplier(64)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_KHeapDrain, 4)->RangeMultiplier(64)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_KHeapDrain, 8)->RangeMultiplier(64)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_KHeapDrain, 16)->RangeMultiplier(64)->Range(1 << 10, 1 << 24);
+
+BENCHMARK_TEMPLATE(BM_BinaryHeapDrainPayload, 4)->RangeMultiplier(64)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_BinaryHeapDrainPayload, 60)->RangeMultiplier(64)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_BinaryHeapDrainPayload, 252)->RangeMultiplier(64)->Range(1 << 10, 1 << 18);
+
+BENCHMARK(BM_PriorityQueueDijkstraReplay)->RangeMultiplier(64)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_IndexedPriorityQueueDijkstraReplay)->RangeMultiplier(64)->Range(1 << 10, 1 << 18);
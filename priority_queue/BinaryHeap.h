@@ -1,7 +1,10 @@
 #ifndef BINARY_HEAP_H
 #define BINARY_HEAP_H
 
-#include <vector>  // std::vector
+#include <functional>   // std::greater, std::less
+#include <memory>       // std::allocator
+#include <type_traits>  // std::is_arithmetic_v, std::is_same_v
+#include <vector>       // std::vector
 
 #include "Heap.h"
 
@@ -17,10 +20,29 @@ namespace heap {
      * IsAlreadyHeap: constexpr bool flag. If true, build_heap() won't be called
      *                after the class is constructed.
      *                If false, the given vector is considered an already valid heap.
+     * Compare: type of the comparison functor, stored inline in the Heap base.
+     *          std::greater<T> yields a Min Heap, std::less<T> a Max Heap.
+     * Derived: the most-derived class of the CRTP chain, or void if BinaryHeap itself is
+     *          the most-derived class. Classes extending BinaryHeap (e.g. PriorityQueue)
+     *          pass themselves here so that the Heap base dispatches statically to them.
+     * Allocator: allocator backing the node vector, e.g. an arena that reclaims the
+     *            whole heap in O(1) when it is discarded.
+     * InlineCapacity: small-buffer threshold forwarded to the Heap base; heaps of up to
+     *                 InlineCapacity elements live inline without allocating.
      */
-    template <typename T, bool IsAlreadyHeap = false>
-    class BinaryHeap : public Heap<T, IsAlreadyHeap> {
-        using super = Heap<T, IsAlreadyHeap>;
+    template <typename T, bool IsAlreadyHeap = false, typename Compare = std::greater<T>,
+              typename Derived = void, typename Allocator = std::allocator<T>,
+              std::size_t InlineCapacity = 0>
+    class BinaryHeap
+        : public Heap<detail::crtp_self_t<Derived, BinaryHeap<T, IsAlreadyHeap, Compare, Derived,
+                                                              Allocator, InlineCapacity>>,
+                      T, Compare, IsAlreadyHeap, Allocator, InlineCapacity> {
+        using self_type = detail::crtp_self_t<Derived, BinaryHeap>;
+        using super = Heap<self_type, T, Compare, IsAlreadyHeap, Allocator, InlineCapacity>;
+
+        // the Heap base invokes parent(), build_heap() and heapify_down() through self()
+        friend super;
+
         // returns the left child of nodes[i]
         [[nodiscard]] static std::size_t left(const std::size_t i) noexcept {
             return (i << 1) + 1;
@@ -36,8 +58,22 @@ namespace heap {
             return i >= (this->size() >> 1) + 1;
         }
 
+        // true iff the two-child winner of heapify_down can be computed arithmetically:
+        // plain std::greater/std::less ordering over an arithmetic type, where comparing
+        // both children unconditionally has no side effects and the result folds into an
+        // index add (cmov/setcc) instead of a data-dependent branch
+        static constexpr bool use_branchless_child_select =
+            std::is_arithmetic_v<T> &&
+            (std::is_same_v<Compare, std::greater<T>> || std::is_same_v<Compare, std::less<T>>);
+
+    public:
+        // allow classes extending BinaryHeap to rebind the CRTP chain to themselves,
+        // possibly with their own comparator type
+        template <typename C, typename D>
+        using rebind = BinaryHeap<T, IsAlreadyHeap, C, D, Allocator, InlineCapacity>;
+
     protected:
-        using compare_t = typename super::compare_t;
+        using compare_type = typename super::compare_type;
 
         // protected constructor to let the subclass set the comparator after the initialization
         explicit BinaryHeap(const std::vector<T>& inputs) noexcept : super(inputs) {
@@ -47,43 +83,93 @@ namespace heap {
         explicit BinaryHeap(std::vector<T>&& inputs) noexcept : super(std::move(inputs)) {
         }
 
+        // protected allocator-aware constructors, same contract as above
+        explicit BinaryHeap(const std::vector<T>& inputs, const Allocator& allocator) :
+            super(inputs, allocator) {
+        }
+
+        explicit BinaryHeap(std::vector<T>&& inputs, const Allocator& allocator) :
+            super(std::move(inputs), allocator) {
+        }
+
+        // number of children per node, used by the level decomposition of the
+        // parallel build
+        static constexpr std::size_t arity = 2;
+
         // return the parent of nodes[i]
-        [[nodiscard]] std::size_t parent(const std::size_t i) const noexcept override final {
+        [[nodiscard]] std::size_t parent(const std::size_t i) const noexcept {
             return (i - 1) >> 1;
         }
 
         // starting from a Heap with a misplaced node at the given index,
-        // recover the shape and heap properties bubbling the node down
-        void heapify_down(const std::size_t index_to_fix) noexcept override {
-            const std::size_t len = this->size();
+        // recover the shape and heap properties bubbling the node down.
+        // The moving element is saved once, the winning children are shifted up into the
+        // hole it leaves behind, and the element is written a single time at its final
+        // position, instead of paying a full swap (3 writes) per level.
+        void heapify_down(const std::size_t index_to_fix) noexcept {
+            heapify_down(index_to_fix, this->size());
+        }
+
+        // same as above, but only the first len slots of nodes take part in the heap.
+        // Used by heapsort, which shrinks the heap by one slot per extracted element.
+        void heapify_down(const std::size_t index_to_fix, const std::size_t len) noexcept {
+            if (index_to_fix >= len) {
+                return;
+            }
+
             std::size_t i = index_to_fix;
+            std::size_t depth = 0;
+            std::size_t comparisons = 0;
+            T moving = std::move(this->node_at(i));
 
             while (!is_leaf(i)) {
                 const auto l = left(i);
                 const auto r = right(i);
 
-                // comp_est is the biggest element in a Max Heap,
-                // or the smallest element in a Min Heap
-                std::size_t comp_est = i;
+                if (l >= len) {
+                    break;
+                }
+
+                // one child-select comparison when both children exist, plus the
+                // comparison against the moving element below
+                comparisons += r < len ? 2 : 1;
 
-                if (l < len && this->comp(this->nodes.at(i), this->nodes.at(l))) {
+                // comp_est is the biggest child in a Max Heap,
+                // or the smallest child in a Min Heap
+                std::size_t comp_est;
+
+                if constexpr (use_branchless_child_select) {
+                    // the comparison result (0 or 1) selects between l and r with pure
+                    // index arithmetic: on random keys the l-vs-r winner is a coin flip
+                    // that a conditional block mispredicts about half the time. The
+                    // r < len guard stays: it only fails for the odd-size tail and is
+                    // perfectly predicted.
+                    comp_est = r < len ? l + static_cast<std::size_t>(
+                                                 this->comp(this->node_at(l), this->node_at(r)))
+                                       : l;
+                } else {
                     comp_est = l;
-                }
-                if (r < len && this->comp(this->nodes.at(comp_est), this->nodes.at(r))) {
-                    comp_est = r;
+
+                    if (r < len && this->comp(this->node_at(l), this->node_at(r))) {
+                        comp_est = r;
+                    }
                 }
 
-                if (i == comp_est) {
-                    return;
+                if (!this->comp(moving, this->node_at(comp_est))) {
+                    break;
                 }
 
-                this->swap_nodes(i, comp_est);
+                this->self().shift_node(i, comp_est);
                 i = comp_est;
+                depth++;
             }
+
+            this->self().place_node(i, std::move(moving));
+            this->stat_count_sift(depth, comparisons);
         }
 
         // transform the internal vector in a heap in O(n)
-        void build_heap() noexcept override final {
+        void build_heap() noexcept {
             for (std::size_t i = (this->size() >> 1) + 1; i > 0; --i) {
                 heapify_down(i - 1);
             }
@@ -93,43 +179,116 @@ namespace heap {
         // disable public default constructor
         BinaryHeap() = delete;
 
-        explicit BinaryHeap(const std::vector<T>& inputs, compare_t&& comp) noexcept :
+        explicit BinaryHeap(const std::vector<T>& inputs, Compare comp) noexcept :
             super(inputs, std::move(comp)) {
             this->init();
         }
 
-        explicit BinaryHeap(std::vector<T>&& inputs, compare_t&& comp) noexcept :
+        explicit BinaryHeap(std::vector<T>&& inputs, Compare comp) noexcept :
             super(std::move(inputs), std::move(comp)) {
             this->init();
         }
 
-        virtual ~BinaryHeap() = default;
+        // allocator-aware constructors: the given instance backs the node vector
+        explicit BinaryHeap(const std::vector<T>& inputs, Compare comp,
+                            const Allocator& allocator) :
+            super(inputs, std::move(comp), allocator) {
+            this->init();
+        }
+
+        explicit BinaryHeap(std::vector<T>&& inputs, Compare comp, const Allocator& allocator) :
+            super(std::move(inputs), std::move(comp), allocator) {
+            this->init();
+        }
+
+        ~BinaryHeap() = default;
     };
 
     // create a Min Heap copying the input vector
     template <bool IsAlreadyHeap = false, typename T>
     auto make_min_heap(const std::vector<T>& inputs) {
-        return BinaryHeap<T, IsAlreadyHeap>(inputs, std::greater<>{});
+        return BinaryHeap<T, IsAlreadyHeap>(inputs, std::greater<T>{});
     }
 
     // create a Min Heap moving the input vector
     template <bool IsAlreadyHeap = false, typename T>
     auto make_min_heap(std::vector<T>&& inputs = {}) {
-        return BinaryHeap<T, IsAlreadyHeap>(std::move(inputs), std::greater<>{});
+        return BinaryHeap<T, IsAlreadyHeap>(std::move(inputs), std::greater<T>{});
     }
 
     // create a Max Heap copying the input vector
     template <bool IsAlreadyHeap = false, typename T>
     auto make_max_heap(const std::vector<T>& inputs) {
-        return BinaryHeap<T, IsAlreadyHeap>(inputs, std::less<>{});
+        return BinaryHeap<T, IsAlreadyHeap, std::less<T>>(inputs, std::less<T>{});
     }
 
     // create a Max Heap moving the input vector
     template <bool IsAlreadyHeap = false, typename T>
     auto make_max_heap(std::vector<T>&& inputs = {}) {
-        return BinaryHeap<T, IsAlreadyHeap>(std::move(inputs), std::less<>{});
+        return BinaryHeap<T, IsAlreadyHeap, std::less<T>>(std::move(inputs), std::less<T>{});
+    }
+
+    // create a Min Heap copying the input vector, backed by the given allocator
+    template <bool IsAlreadyHeap = false, typename T, typename Allocator>
+    auto make_min_heap(const std::vector<T>& inputs, const Allocator& allocator) {
+        return BinaryHeap<T, IsAlreadyHeap, std::greater<T>, void, Allocator>(
+            inputs, std::greater<T>{}, allocator);
+    }
+
+    // create a Min Heap moving the input vector, backed by the given allocator
+    template <bool IsAlreadyHeap = false, typename T, typename Allocator>
+    auto make_min_heap(std::vector<T>&& inputs, const Allocator& allocator) {
+        return BinaryHeap<T, IsAlreadyHeap, std::greater<T>, void, Allocator>(
+            std::move(inputs), std::greater<T>{}, allocator);
+    }
+
+    // create a Max Heap copying the input vector, backed by the given allocator
+    template <bool IsAlreadyHeap = false, typename T, typename Allocator>
+    auto make_max_heap(const std::vector<T>& inputs, const Allocator& allocator) {
+        return BinaryHeap<T, IsAlreadyHeap, std::less<T>, void, Allocator>(inputs, std::less<T>{},
+                                                                           allocator);
+    }
+
+    // create a Max Heap moving the input vector, backed by the given allocator
+    template <bool IsAlreadyHeap = false, typename T, typename Allocator>
+    auto make_max_heap(std::vector<T>&& inputs, const Allocator& allocator) {
+        return BinaryHeap<T, IsAlreadyHeap, std::less<T>, void, Allocator>(
+            std::move(inputs), std::less<T>{}, allocator);
+    }
+
+    // create a Min Heap with inline storage for up to InlineCapacity elements: tiny
+    // short-lived heaps never touch the allocator
+    template <std::size_t InlineCapacity, typename T>
+    auto make_min_small_heap() {
+        return BinaryHeap<T, false, std::greater<T>, void, std::allocator<T>, InlineCapacity>(
+            std::vector<T>{}, std::greater<T>{});
+    }
+
+    // create a Max Heap with inline storage for up to InlineCapacity elements
+    template <std::size_t InlineCapacity, typename T>
+    auto make_max_small_heap() {
+        return BinaryHeap<T, false, std::less<T>, void, std::allocator<T>, InlineCapacity>(
+            std::vector<T>{}, std::less<T>{});
+    }
+
+    // create a Min Heap moving the input vector and running the initial build with
+    // up to num_threads worker threads (0 picks the hardware concurrency)
+    template <typename T>
+    auto make_min_heap_parallel(std::vector<T>&& inputs, const std::size_t num_threads = 0) {
+        BinaryHeap<T, true> heap(std::move(inputs), std::greater<T>{});
+        heap.build_heap_parallel(num_threads);
+        return heap;
+    }
+
+    // create a Max Heap moving the input vector and running the initial build with
+    // up to num_threads worker threads (0 picks the hardware concurrency)
+    template <typename T>
+    auto make_max_heap_parallel(std::vector<T>&& inputs, const std::size_t num_threads = 0) {
+        BinaryHeap<T, true, std::less<T>> heap(std::move(inputs), std::less<T>{});
+        heap.build_heap_parallel(num_threads);
+        return heap;
     }
 
 }  // namespace heap
 
-#endif  // BINARY_HEAP_H
\ No newline at end of file
+#endif  // BINARY_HEAP_H
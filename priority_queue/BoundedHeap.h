@@ -0,0 +1,116 @@
+#ifndef BOUNDED_HEAP_H
+#define BOUNDED_HEAP_H
+
+#include <cassert>     // std::assert
+#include <cstddef>     // std::size_t
+#include <functional>  // std::greater, std::less
+#include <utility>     // std::move
+#include <vector>      // std::vector
+
+#include "BinaryHeap.h"
+#include "Heap.h"
+
+namespace heap {
+
+    /**
+     * Binary Heap with a fixed capacity k, meant for streaming top-k selection.
+     * The heap keeps at most k elements: once full, push_if_better() compares the
+     * candidate against the root (the worst retained element under the heap order) and
+     * either rejects it in O(1) or replaces the root in place and sifts it down, without
+     * ever growing the backing vector.
+     *
+     * With the Min Heap flavor (make_bounded_min_heap) the root is the smallest retained
+     * element, so the heap keeps the k LARGEST elements of the stream; symmetrically, the
+     * Max Heap flavor (make_bounded_max_heap) keeps the k SMALLEST.
+     * This class shouldn't be invoked directly; the factories should be used instead.
+     *
+     * T: the type of the objects stored in the heap.
+     * Compare: type of the comparison functor, stored inline in the Heap base.
+     *          std::greater<T> yields a Min Heap, std::less<T> a Max Heap.
+     */
+    template <typename T, typename Compare = std::greater<T>>
+    class BoundedHeap : public BinaryHeap<T, false, Compare, BoundedHeap<T, Compare>> {
+        using super = BinaryHeap<T, false, Compare, BoundedHeap<T, Compare>>;
+
+        // the bases invoke the sift hooks through self(), which is typed BoundedHeap here
+        friend super;
+        friend class Heap<BoundedHeap, T, Compare, false>;
+
+        // maximum number of elements ever held
+        std::size_t max_capacity;
+
+    public:
+        // disable public default constructor
+        BoundedHeap() = delete;
+
+        explicit BoundedHeap(const std::size_t capacity, Compare comp) :
+            super(std::vector<T>{}, std::move(comp)), max_capacity(capacity) {
+            assert(capacity > 0);
+
+            this->nodes.reserve(capacity);
+        }
+
+        // return the maximum number of elements the heap retains
+        [[nodiscard]] std::size_t capacity() const noexcept {
+            return max_capacity;
+        }
+
+        // return true iff the heap holds capacity() elements
+        [[nodiscard]] bool full() const noexcept {
+            return this->size() == max_capacity;
+        }
+
+        // offer an element to the heap. While the heap isn't full the element is always
+        // inserted (O(logk)). Once full, the element is rejected in O(1) if it doesn't
+        // beat the root, and otherwise replaces the root in place followed by a single
+        // sift down (O(logk)), so memory stays flat at k elements.
+        // Returns true iff the element was retained.
+        bool push_if_better(const T& element) {
+            if (!full()) {
+                this->push(element);
+                return true;
+            }
+
+            // comp answers "is a ordered after b": the candidate must beat the root,
+            // i.e. the worst element currently retained
+            if (!this->comp(element, this->top())) {
+                return false;
+            }
+
+            this->node_at(0) = element;
+            this->heapify_down(0);
+
+            return true;
+        }
+
+        // move the retained elements out, sorted from worst to best retained (i.e. in
+        // heap-order pops). The heap is left empty.
+        [[nodiscard]] std::vector<T> extract() {
+            std::vector<T> result;
+            result.reserve(this->size());
+
+            while (!this->empty()) {
+                result.emplace_back(this->pop_top());
+            }
+
+            return result;
+        }
+    };
+
+    // create a bounded Min Heap that retains the capacity largest elements offered to
+    // push_if_better()
+    template <typename T>
+    [[nodiscard]] auto make_bounded_min_heap(const std::size_t capacity) {
+        return BoundedHeap<T, std::greater<T>>(capacity, std::greater<T>{});
+    }
+
+    // create a bounded Max Heap that retains the capacity smallest elements offered to
+    // push_if_better()
+    template <typename T>
+    [[nodiscard]] auto make_bounded_max_heap(const std::size_t capacity) {
+        return BoundedHeap<T, std::less<T>>(capacity, std::less<T>{});
+    }
+
+}  // namespace heap
+
+#endif  // BOUNDED_HEAP_H
@@ -0,0 +1,249 @@
+#ifndef CONCURRENT_PRIORITY_QUEUE_H
+#define CONCURRENT_PRIORITY_QUEUE_H
+
+#include <algorithm>  // std::max, std::swap
+#include <atomic>     // std::atomic
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint64_t
+#include <memory>     // std::unique_ptr
+#include <mutex>      // std::mutex, std::lock_guard, std::unique_lock
+#include <optional>   // std::optional
+#include <random>     // std::random_device
+#include <thread>     // std::thread
+#include <utility>    // std::move, std::pair
+#include <vector>     // std::vector
+
+#include "BinaryHeap.h"
+#include "PriorityQueue.h"
+
+namespace concurrent {
+
+    namespace detail {
+
+        // (key, element) pair stored in each sub-queue. The element rides along and never
+        // takes part in comparisons.
+        template <typename Key, typename T>
+        struct entry_t {
+            Key key;
+            T element;
+        };
+
+        // order entries by key only, Min Heap flavor
+        template <typename Key, typename T>
+        struct min_entry_compare {
+            [[nodiscard]] bool operator()(const entry_t<Key, T>& a,
+                                          const entry_t<Key, T>& b) const {
+                return a.key > b.key;
+            }
+        };
+
+        // order entries by key only, Max Heap flavor
+        template <typename Key, typename T>
+        struct max_entry_compare {
+            [[nodiscard]] bool operator()(const entry_t<Key, T>& a,
+                                          const entry_t<Key, T>& b) const {
+                return a.key < b.key;
+            }
+        };
+
+        // small per-thread xorshift generator used to pick sub-queues without sharing any
+        // state (and without the cost of std::mt19937 per call)
+        [[nodiscard]] inline std::size_t random_index(const std::size_t bound) noexcept {
+            thread_local std::uint64_t state = std::random_device{}() | 1;
+
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            return static_cast<std::size_t>(state % bound);
+        }
+
+    }  // namespace detail
+
+    /**
+     * Relaxed concurrent priority queue based on the MultiQueue design: C independent
+     * sub-queues, each a BinaryHeap of (key, element) entries guarded by its own mutex.
+     * push() inserts into a random sub-queue; try_pop() peeks two random sub-queues and
+     * pops from the one with the better top ("power of two choices"). Threads therefore
+     * contend on different locks with high probability and throughput scales with cores,
+     * at the price of a relaxed ordering guarantee: try_pop() returns an element that is
+     * among the best ones with high probability, not necessarily the global best.
+     *
+     * Key: type of the keys used to order the elements.
+     * T: type of the elements stored in the priority queue.
+     * HeapType: min_heap or max_heap flavor of the underlying sub-queues.
+     */
+    template <typename Key, typename T,
+              priority_queue::Type HeapType = priority_queue::Type::min_heap>
+    class PriorityQueue {
+        using entry_type = detail::entry_t<Key, T>;
+        using compare_type =
+            std::conditional_t<HeapType == priority_queue::Type::min_heap,
+                               detail::min_entry_compare<Key, T>,
+                               detail::max_entry_compare<Key, T>>;
+        using heap_type = heap::BinaryHeap<entry_type, false, compare_type>;
+
+        // a sub-queue and its lock, padded apart via unique_ptr indirection so that two
+        // threads hitting different sub-queues never share a cache line of this class
+        struct sub_queue_t {
+            std::mutex mutex;
+            heap_type heap;
+
+            sub_queue_t() : heap(std::vector<entry_type>{}, compare_type{}) {
+            }
+        };
+
+        std::vector<std::unique_ptr<sub_queue_t>> sub_queues;
+
+        // approximate element count, maintained with relaxed atomics; exact counting
+        // would reintroduce the very serialization this class is designed to avoid
+        std::atomic<std::size_t> approximate_size{0};
+
+        // return true iff entry a beats entry b for the configured heap flavor
+        [[nodiscard]] static bool beats(const entry_type& a, const entry_type& b) {
+            // the stored comparators answer "is a worse than b", like the heap ones
+            return compare_type{}(b, a);
+        }
+
+    public:
+        // disable public default constructor
+        PriorityQueue() = delete;
+
+        // num_queues should be at least twice the number of threads sharing the queue;
+        // 0 picks that default from std::thread::hardware_concurrency()
+        explicit PriorityQueue(std::size_t num_queues) {
+            if (num_queues == 0) {
+                num_queues = 2 * std::max(1u, std::thread::hardware_concurrency());
+            }
+
+            sub_queues.reserve(num_queues);
+            for (std::size_t i = 0; i < num_queues; ++i) {
+                sub_queues.emplace_back(std::make_unique<sub_queue_t>());
+            }
+        }
+
+        // return the approximate number of elements in the queue. Exact only while no
+        // other thread is pushing or popping
+        [[nodiscard]] std::size_t size() const noexcept {
+            return approximate_size.load(std::memory_order_relaxed);
+        }
+
+        // return true iff the queue appears empty. Subject to the same caveat as size()
+        [[nodiscard]] bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        // add a new element with the given key to a random sub-queue
+        void push(const Key& key, const T& element) {
+            auto& sub_queue = *sub_queues[detail::random_index(sub_queues.size())];
+
+            {
+                std::lock_guard<std::mutex> lock(sub_queue.mutex);
+                sub_queue.heap.push(entry_type{key, element});
+            }
+
+            approximate_size.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // remove and return one of the best (key, element) pairs in the queue, or
+        // std::nullopt if every sub-queue is empty. Two random sub-queues are peeked and
+        // the one with the better top is popped; if both are empty, all sub-queues are
+        // scanned once before giving up
+        [[nodiscard]] std::optional<std::pair<Key, T>> try_pop() {
+            const std::size_t count = sub_queues.size();
+            std::size_t first = detail::random_index(count);
+            std::size_t second = detail::random_index(count);
+
+            if (first == second && count > 1) {
+                second = (second + 1) % count;
+            }
+
+            // lock in index order so that concurrent try_pop() calls can't deadlock
+            if (second < first) {
+                std::swap(first, second);
+            }
+
+            {
+                std::lock_guard<std::mutex> first_lock(sub_queues[first]->mutex);
+                // with a single sub-queue both picks collapse onto the same mutex, which
+                // must not be locked twice
+                std::unique_lock<std::mutex> second_lock;
+                if (second != first) {
+                    second_lock = std::unique_lock<std::mutex>(sub_queues[second]->mutex);
+                }
+
+                heap_type* best = nullptr;
+
+                if (!sub_queues[first]->heap.empty()) {
+                    best = &sub_queues[first]->heap;
+                }
+                if (second != first && !sub_queues[second]->heap.empty() &&
+                    (best == nullptr || beats(sub_queues[second]->heap.top(), best->top()))) {
+                    best = &sub_queues[second]->heap;
+                }
+
+                if (best != nullptr) {
+                    entry_type entry = best->pop_top();
+                    approximate_size.fetch_sub(1, std::memory_order_relaxed);
+                    return std::make_pair(std::move(entry.key), std::move(entry.element));
+                }
+            }
+
+            // both random picks were empty: fall back to a full scan, so that the queue
+            // is drained completely even when only a few sub-queues still hold elements
+            for (std::size_t i = 0; i < count; ++i) {
+                std::lock_guard<std::mutex> lock(sub_queues[i]->mutex);
+
+                if (!sub_queues[i]->heap.empty()) {
+                    entry_type entry = sub_queues[i]->heap.pop_top();
+                    approximate_size.fetch_sub(1, std::memory_order_relaxed);
+                    return std::make_pair(std::move(entry.key), std::move(entry.element));
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        // return a copy of one of the best (key, element) pairs without removing it, or
+        // std::nullopt if the queue appears empty. Inherently a snapshot: another thread
+        // may pop the returned element right after this call returns
+        [[nodiscard]] std::optional<std::pair<Key, T>> top() const {
+            // the best candidate is copied out under its sub-queue's lock: a reference
+            // (or a pointer into the sub-queue) would be read unsynchronized once the
+            // scan moves on and another thread pushes into or pops from that sub-queue
+            std::optional<entry_type> best;
+
+            for (const auto& sub_queue : sub_queues) {
+                std::lock_guard<std::mutex> lock(sub_queue->mutex);
+
+                if (!sub_queue->heap.empty() &&
+                    (!best.has_value() || beats(sub_queue->heap.top(), *best))) {
+                    best = sub_queue->heap.top();
+                }
+            }
+
+            if (!best.has_value()) {
+                return std::nullopt;
+            }
+
+            return std::make_pair(std::move(best->key), std::move(best->element));
+        }
+    };
+
+    // create a relaxed concurrent Min Priority Queue with the given number of sub-queues
+    // (0 picks a default based on the hardware concurrency)
+    template <typename Key, typename T>
+    [[nodiscard]] auto make_min_concurrent_priority_queue(const std::size_t num_queues = 0) {
+        return PriorityQueue<Key, T, priority_queue::Type::min_heap>(num_queues);
+    }
+
+    // create a relaxed concurrent Max Priority Queue with the given number of sub-queues
+    // (0 picks a default based on the hardware concurrency)
+    template <typename Key, typename T>
+    [[nodiscard]] auto make_max_concurrent_priority_queue(const std::size_t num_queues = 0) {
+        return PriorityQueue<Key, T, priority_queue::Type::max_heap>(num_queues);
+    }
+
+}  // namespace concurrent
+
+#endif  // CONCURRENT_PRIORITY_QUEUE_H
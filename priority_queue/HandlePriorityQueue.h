@@ -0,0 +1,352 @@
+#ifndef HANDLE_PRIORITY_QUEUE_H
+#define HANDLE_PRIORITY_QUEUE_H
+
+#include <cassert>      // std::assert
+#include <cstddef>      // std::size_t
+#include <functional>   // std::greater, std::less
+#include <limits>       // std::numeric_limits
+#include <type_traits>  // std::conditional_t, std::is_base_of
+#include <utility>      // std::move, std::pair
+#include <vector>       // std::vector
+
+#include "BinaryHeap.h"
+#include "Heap.h"
+#include "KHeap.h"
+#include "PriorityQueue.h"
+
+namespace priority_queue {
+
+    namespace detail {
+
+        // order handles by the key of the slot they point to, Min Heap flavor. Holds a
+        // pointer to the slot vector object (stable across reallocations), so the key
+        // lookup is one indexed load instead of a hash probe.
+        template <typename SlotVector>
+        class handle_min_compare {
+            const SlotVector* slots = nullptr;
+
+        public:
+            handle_min_compare() = default;
+
+            explicit handle_min_compare(const SlotVector& slots) noexcept : slots(&slots) {
+            }
+
+            [[nodiscard]] bool operator()(const std::size_t a, const std::size_t b) const {
+                return (*slots)[a].key > (*slots)[b].key;
+            }
+        };
+
+        // order handles by the key of the slot they point to, Max Heap flavor
+        template <typename SlotVector>
+        class handle_max_compare {
+            const SlotVector* slots = nullptr;
+
+        public:
+            handle_max_compare() = default;
+
+            explicit handle_max_compare(const SlotVector& slots) noexcept : slots(&slots) {
+            }
+
+            [[nodiscard]] bool operator()(const std::size_t a, const std::size_t b) const {
+                return (*slots)[a].key < (*slots)[b].key;
+            }
+        };
+
+        // one slot per entry of a HandlePriorityQueue; position tracks where its
+        // handle currently sits in the heap, npos marks a slot on the free list
+        template <typename Key, typename T>
+        struct handle_slot_t {
+            Key key;
+            T element;
+            std::size_t position;
+        };
+
+    }  // namespace detail
+
+    /**
+     * Priority Queue addressed by handles instead of element values. push() returns a
+     * stable handle_t that stays valid until the entry is popped or removed, and
+     * update_key()/remove()/key_at() take that handle directly.
+     *
+     * Every entry lives in a free-list slot vector (key, element, heap position); the
+     * heap itself orders plain slot indices. Compared with PriorityQueue this lifts
+     * both restrictions of the value-keyed maps — T no longer needs to be hashable and
+     * duplicate elements are fine — and replaces every hash probe on the
+     * push/decrease-key hot path with an indexed load.
+     * This class shouldn't be invoked directly.
+     * Instead, the factories make_min_handle_priority_queue etc. should be used.
+     *
+     * Heap: the heap engine ordering the handles (BinaryHeap or KHeap of std::size_t).
+     * Key: type of the keys used to order the elements.
+     * T: the type of the elements. Neither hashable nor unique elements are required.
+     * HeapType: min_heap or max_heap flavor.
+     */
+    template <class Heap, typename Key, typename T, Type HeapType = Type::min_heap>
+    class HandlePriorityQueue
+        : private Heap::template rebind<
+              std::conditional_t<
+                  HeapType == Type::min_heap,
+                  detail::handle_min_compare<std::vector<detail::handle_slot_t<Key, T>>>,
+                  detail::handle_max_compare<std::vector<detail::handle_slot_t<Key, T>>>>,
+              HandlePriorityQueue<Heap, Key, T, HeapType>> {
+    public:
+        // stable identifier returned by push(): an index into the slot vector
+        using handle_t = std::size_t;
+
+    private:
+        using slot_type = detail::handle_slot_t<Key, T>;
+        using slot_vector = std::vector<slot_type>;
+
+        using compare_type =
+            std::conditional_t<HeapType == Type::min_heap,
+                               detail::handle_min_compare<slot_vector>,
+                               detail::handle_max_compare<slot_vector>>;
+
+        using super = typename Heap::template rebind<compare_type, HandlePriorityQueue>;
+
+        // the heap classes reach the protected members of this class through self()
+        friend super;
+        friend class heap::Heap<HandlePriorityQueue, std::size_t, compare_type, false,
+                                typename Heap::allocator_type>;
+
+        static_assert(
+            std::is_base_of<heap::Heap<HandlePriorityQueue, std::size_t, compare_type, false,
+                                       typename Heap::allocator_type>,
+                            super>::value,
+            "Heap must derive heap::Heap");
+
+        static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+        // slots[handle] -> (key, element, heap position) of the entry
+        slot_vector slots;
+
+        // handles of the dead slots, recycled before the slot vector grows
+        std::vector<handle_t> free_handles;
+
+        // take a dead slot off the free list, or append a fresh one
+        [[nodiscard]] handle_t allocate_handle(const Key& key, const T& element) {
+            if (!free_handles.empty()) {
+                const handle_t handle = free_handles.back();
+                free_handles.pop_back();
+
+                slots[handle] = slot_type{key, element, npos};
+                return handle;
+            }
+
+            slots.emplace_back(slot_type{key, element, npos});
+            return slots.size() - 1;
+        }
+
+        // put a slot on the free list; the stale key/element stay in place until the
+        // slot is recycled
+        void release_handle(const handle_t handle) {
+            slots[handle].position = npos;
+            free_handles.emplace_back(handle);
+        }
+
+        // remove the heap entry at the given index, moving the last entry into the hole
+        // and sifting it in whichever direction restores the heap order
+        void erase_at(const std::size_t index) {
+            const std::size_t root = super::layout_offset();
+            const std::size_t last = this->nodes.size() - 1;
+
+            if (index == last) {
+                this->nodes.pop_back();
+                return;
+            }
+
+            const handle_t moved = this->node_at(last);
+            this->nodes.pop_back();
+            this->node_at(index) = moved;
+            slots[moved].position = index;
+
+            if (index > root &&
+                this->comp(this->node_at(this->parent(index)), this->node_at(index))) {
+                this->heapify_up(index);
+            } else {
+                this->heapify_down(index);
+            }
+        }
+
+    protected:
+        // heap hooks: handles move through the heap, the slot positions follow
+        void swap_nodes(const std::size_t i, const std::size_t j) noexcept {
+            super::swap_nodes(i, j);
+            slots[this->node_at(i)].position = i;
+            slots[this->node_at(j)].position = j;
+        }
+
+        void shift_node(const std::size_t dst, const std::size_t src) noexcept {
+            super::shift_node(dst, src);
+            slots[this->node_at(dst)].position = dst;
+        }
+
+        void place_node(const std::size_t index, std::size_t&& handle) noexcept {
+            slots[handle].position = index;
+            super::place_node(index, std::move(handle));
+        }
+
+    public:
+        HandlePriorityQueue() :
+            super(std::vector<std::size_t>{}, compare_type{}) {
+            // the comparator can only point at slots once the member exists
+            this->comp = compare_type(slots);
+        }
+
+        ~HandlePriorityQueue() = default;
+
+        using super::empty;
+        using super::size;
+
+        // pre-size the heap, the slot vector and the free list for the given number
+        // of elements
+        void reserve(const std::size_t capacity) {
+            super::reserve(capacity);
+            slots.reserve(capacity);
+            free_handles.reserve(capacity);
+        }
+
+        // select the growth policy applied to the heap vector on push
+        void set_growth_policy(const heap::growth_policy policy) noexcept {
+            super::set_growth_policy(policy);
+        }
+
+        // return the operation counters collected under HEAP_STATS (zeroed otherwise)
+        [[nodiscard]] const heap::stats_t& stats() const noexcept {
+            return super::stats();
+        }
+
+        // return true iff the handle refers to a live entry
+        [[nodiscard]] bool valid(const handle_t handle) const noexcept {
+            return handle < slots.size() && slots[handle].position != npos;
+        }
+
+        // add a new element with the given key and return its stable handle.
+        // Time: O(logN) amortized if using BinaryHeap, O(k*log_k(N)) amortized instead.
+        [[nodiscard]] handle_t push(const Key& key, const T& element) {
+            const handle_t handle = allocate_handle(key, element);
+            super::push(handle);
+
+            return handle;
+        }
+
+        // update the key of the entry behind the given handle, in either direction.
+        // Time: O(logN) amortized, with zero hash probes.
+        void update_key(const handle_t handle, const Key& key) {
+            assert(valid(handle));
+
+            this->stat_count_update();
+
+            const Key old_key = std::move(slots[handle].key);
+            slots[handle].key = key;
+            const std::size_t index_to_fix = slots[handle].position;
+
+            if constexpr (HeapType == Type::min_heap) {
+                if (old_key > key) {
+                    this->heapify_up(index_to_fix);
+                } else {
+                    this->heapify_down(index_to_fix);
+                }
+            } else {
+                if (old_key < key) {
+                    this->heapify_up(index_to_fix);
+                } else {
+                    this->heapify_down(index_to_fix);
+                }
+            }
+        }
+
+        // remove the entry behind the given handle, which becomes invalid.
+        // Time: O(logN) amortized.
+        void remove(const handle_t handle) {
+            assert(valid(handle));
+
+            const std::size_t index = slots[handle].position;
+            release_handle(handle);
+            erase_at(index);
+        }
+
+        // return the key of the entry behind the given handle.
+        // Time: O(1).
+        [[nodiscard]] const Key& key_at(const handle_t handle) const {
+            assert(valid(handle));
+
+            return slots[handle].key;
+        }
+
+        // return the element of the entry behind the given handle.
+        // Time: O(1).
+        [[nodiscard]] const T& element_at(const handle_t handle) const {
+            assert(valid(handle));
+
+            return slots[handle].element;
+        }
+
+        // return the top element.
+        // Time: O(1).
+        [[nodiscard]] const T& top() const {
+            return slots[super::top()].element;
+        }
+
+        // return the (key, element) of the top entry.
+        // Time: O(1).
+        [[nodiscard]] std::pair<const Key&, const T&> top_key_value() const {
+            const slot_type& slot = slots[super::top()];
+            return {slot.key, slot.element};
+        }
+
+        // remove the top entry and return its (key, element) pair; its handle becomes
+        // invalid.
+        // Time: O(logN) amortized.
+        [[nodiscard]] std::pair<Key, T> pop_top() {
+            const handle_t handle = super::pop_top();
+
+            std::pair<Key, T> result{std::move(slots[handle].key),
+                                     std::move(slots[handle].element)};
+            release_handle(handle);
+
+            return result;
+        }
+
+        // remove the top entry; its handle becomes invalid.
+        // Time: O(logN) amortized.
+        void pop() {
+            release_handle(super::pop_top());
+        }
+    };
+
+    // create a handle-addressed Priority Queue based on a Min Heap
+    template <typename Key, typename Value>
+    auto make_min_handle_priority_queue() {
+        using pq = HandlePriorityQueue<heap::BinaryHeap<std::size_t>, Key, Value,
+                                       Type::min_heap>;
+        return pq();
+    }
+
+    // create a handle-addressed Priority Queue based on a Max Heap
+    template <typename Key, typename Value>
+    auto make_max_handle_priority_queue() {
+        using pq = HandlePriorityQueue<heap::BinaryHeap<std::size_t>, Key, Value,
+                                       Type::max_heap>;
+        return pq();
+    }
+
+    // create a handle-addressed Priority Queue based on a Min K-Heap
+    template <std::size_t K, typename Key, typename Value>
+    auto make_min_handle_k_priority_queue() {
+        using pq =
+            HandlePriorityQueue<heap::KHeap<K, std::size_t>, Key, Value, Type::min_heap>;
+        return pq();
+    }
+
+    // create a handle-addressed Priority Queue based on a Max K-Heap
+    template <std::size_t K, typename Key, typename Value>
+    auto make_max_handle_k_priority_queue() {
+        using pq =
+            HandlePriorityQueue<heap::KHeap<K, std::size_t>, Key, Value, Type::max_heap>;
+        return pq();
+    }
+
+}  // namespace priority_queue
+
+#endif  // HANDLE_PRIORITY_QUEUE_H
@@ -1,67 +1,356 @@
 #ifndef HEAP_H
 #define HEAP_H
 
-#include <algorithm>   // std::swap
-#include <cassert>     // std::assert
-#include <functional>  // std::function
-#include <vector>      // std::vector
+#include <algorithm>    // std::swap, std::reverse
+#include <array>        // std::array
+#include <cassert>      // std::assert
+#include <cstdint>      // std::uint64_t
+#include <iterator>     // std::make_move_iterator
+#include <memory>       // std::allocator
+#include <thread>       // std::thread
+#include <type_traits>  // std::conditional_t, std::is_void_v
+#include <utility>      // std::move
+#include <vector>       // std::vector
+
+#include "SmallBuffer.h"
 
 namespace heap {
 
+    namespace detail {
+
+        // resolve the most-derived class of a CRTP chain: Self if explicitly given,
+        // Fallback (the class currently being defined) otherwise.
+        template <typename Self, typename Fallback>
+        using crtp_self_t = std::conditional_t<std::is_void_v<Self>, Fallback, Self>;
+
+    }  // namespace detail
+
+    // growth policy applied to the backing vector when a push would trigger a reallocation.
+    // vector_default: leave the growth to the vector implementation (typically 2x).
+    // exact: grow to exactly the needed size. No wasted memory, but repeated single
+    //        pushes degrade to O(n) each; best combined with reserve()/push_range().
+    // one_point_five: grow by 1.5x, trading some push cost for ~25% less slack than 2x.
+    // power_of_two: grow to the next power of two, allocator-friendly sizes.
+    enum class growth_policy { vector_default, exact, one_point_five, power_of_two };
+
+    // operation counters and sift-depth histogram collected by every heap when the
+    // HEAP_STATS compile-time flag is on (see STATS_COPTS in variables.bzl). Without the
+    // flag no counter is stored or updated and stats() returns a zeroed instance, so
+    // production builds pay nothing. The counters are plain non-atomic fields and
+    // assume a single-threaded heap; build_heap_parallel() therefore falls back to the
+    // sequential build when HEAP_STATS is defined, instead of racing the workers on
+    // the shared counters.
+    struct stats_t {
+        std::uint64_t pushes = 0;
+        std::uint64_t pops = 0;
+        std::uint64_t updates = 0;
+        std::uint64_t comparisons = 0;
+        std::uint64_t node_moves = 0;
+        // pushes that found the backing container full, i.e. triggered a reallocation
+        std::uint64_t reallocations = 0;
+        // sift_depth[d] counts the sifts (up or down) that moved an element d levels;
+        // the last bucket absorbs anything deeper
+        std::array<std::uint64_t, 64> sift_depth{};
+    };
+
     /**
-     * Generic Heap abstract class. The elements are allocated in a std::vector<T> container.
+     * Generic Heap base class. The elements are allocated in a std::vector<T> container.
+     * The class is a CRTP base: Derived is the most-derived heap class, and every hot-path
+     * customization point (parent(), build_heap(), heapify_down(), swap_nodes(), shift_node(),
+     * place_node()) is resolved statically against Derived via self(). No virtual dispatch is
+     * involved, so the sift loops of the concrete heaps can be fully inlined.
      *
+     * Derived: the most-derived heap class (e.g. BinaryHeap, KHeap or PriorityQueue).
      * T: the type of the objects stored in the heap.
+     * Compare: type of the comparison functor. It is stored inline (no type erasure) and
+     *          invoked with const references, so comparisons can be inlined and never copy T.
      * IsAlreadyHeap: constexpr bool flag. If true, build_heap() won't be called
      *                after the child class is constructed.
      *                If false, the given vector is considered an already valid heap.
+     * Allocator: allocator used for the backing vector, e.g. to over-align it to the
+     *            cache line size.
+     * InlineCapacity: small-buffer threshold. When positive, the backing container is a
+     *                 detail::small_vector that stores up to InlineCapacity elements
+     *                 inline, so short-lived tiny heaps never allocate; 0 (the default)
+     *                 keeps the plain std::vector.
      */
-    template <typename T, bool IsAlreadyHeap = false>
+    template <typename Derived, typename T, typename Compare, bool IsAlreadyHeap = false,
+              typename Allocator = std::allocator<T>, std::size_t InlineCapacity = 0>
     class Heap {
+    public:
+        // allocator used for the backing vector; exposed so that classes layering
+        // bookkeeping on top (e.g. PriorityQueue) can rebind it for their own containers
+        using allocator_type = Allocator;
+
+        // small-buffer threshold of the backing container, exposed so that derived
+        // layers can name this exact base specialization (e.g. in friend declarations)
+        static constexpr std::size_t inline_capacity = InlineCapacity;
+
     protected:
-        // comparison function alias type
-        using compare_t = std::function<bool(T, T)>;
+        // comparison functor alias type
+        using compare_type = Compare;
 
-        // keep the values in the heap
-        std::vector<T> nodes;
+        // backing container alias type: a plain vector, or the small-buffer container
+        // when an inline capacity is configured
+        using container_type =
+            std::conditional_t<InlineCapacity == 0, std::vector<T, Allocator>,
+                               detail::small_vector<T, InlineCapacity, Allocator>>;
 
-        // comparison functor
-        // std::greater<> -> Min Heap
-        // std::less<>    -> Max Heap
-        compare_t comp;
+        // keep the values in the heap. The first Derived::layout_offset() slots are
+        // layout padding, not heap elements; the root lives at index layout_offset().
+        container_type nodes;
 
-        // protected constructor to let the subclass set the comparator after the initialization
-        explicit Heap(const std::vector<T>& inputs) noexcept : nodes(inputs) {
+        // convert a plain input vector into the backing container. When the allocator is
+        // the default one this is a no-op move (or copy); otherwise the elements are
+        // transferred one by one.
+        [[nodiscard]] static container_type make_container(std::vector<T>&& inputs) {
+            if constexpr (std::is_same_v<container_type, std::vector<T>>) {
+                return std::move(inputs);
+            } else {
+                return container_type(std::make_move_iterator(inputs.begin()),
+                                      std::make_move_iterator(inputs.end()));
+            }
         }
 
-        // protected constructor to let the subclass set the comparator after the initialization
-        explicit Heap(std::vector<T>&& inputs) noexcept : nodes(inputs) {
+        [[nodiscard]] static container_type make_container(const std::vector<T>& inputs) {
+            if constexpr (std::is_same_v<container_type, std::vector<T>>) {
+                return inputs;
+            } else {
+                return container_type(inputs.begin(), inputs.end());
+            }
         }
 
-        // return the parent of nodes[i]
-        [[nodiscard]] virtual std::size_t parent(std::size_t i) const noexcept = 0;
+        // same as above, but propagating a (possibly stateful) allocator instance,
+        // e.g. an arena handed in by the caller
+        [[nodiscard]] static container_type make_container(std::vector<T>&& inputs,
+                                                           const Allocator& allocator) {
+            return container_type(std::make_move_iterator(inputs.begin()),
+                                  std::make_move_iterator(inputs.end()), allocator);
+        }
 
-        // transform the internal vector in a heap in O(n)
-        virtual void build_heap() noexcept = 0;
+        [[nodiscard]] static container_type make_container(const std::vector<T>& inputs,
+                                                           const Allocator& allocator) {
+            return container_type(inputs.begin(), inputs.end(), allocator);
+        }
 
-        // starting from a Heap with a misplaced node at the given index,
-        // recover the shape and heap properties bubbling the node down.
-        virtual void heapify_down(std::size_t index_to_fix) noexcept = 0;
+        // number of padding slots kept at the front of nodes. Derived classes with a
+        // cache-friendly layout (e.g. the cache-aligned KHeap) shadow this.
+        [[nodiscard]] static constexpr std::size_t layout_offset() noexcept {
+            return 0;
+        }
 
-        // swap 2 nodes in the heap
-        virtual void swap_nodes(std::size_t i, std::size_t j) noexcept {
-            std::swap(nodes.at(i), nodes.at(j));
+        // insert the layout padding required by Derived at the front of nodes.
+        // Must be called by the concrete class before init(). T must be default
+        // constructible if Derived::layout_offset() > 0.
+        void insert_layout_padding() {
+            if constexpr (Derived::layout_offset() > 0) {
+                nodes.insert(nodes.begin(), Derived::layout_offset(), T());
+            }
+        }
+
+        // access the node at physical index i. In release builds this is a plain
+        // unchecked operator[]: every caller has already proven the index in range via
+        // its own is_leaf()/len guards, and the range check plus potential-throw branch
+        // of .at() keeps the sift loops from vectorizing. Defining HEAP_CHECKED_ACCESS
+        // (see variables.bzl) restores the checked access for debug/sanitizer builds.
+        [[nodiscard]] T& node_at(const std::size_t i) {
+#ifdef HEAP_CHECKED_ACCESS
+            return nodes.at(i);
+#else
+            assert(i < nodes.size());
+            return nodes[i];
+#endif
+        }
+
+        [[nodiscard]] const T& node_at(const std::size_t i) const {
+#ifdef HEAP_CHECKED_ACCESS
+            return nodes.at(i);
+#else
+            assert(i < nodes.size());
+            return nodes[i];
+#endif
+        }
+
+        // comparison functor, stored inline.
+        // std::greater<T> -> Min Heap
+        // std::less<T>    -> Max Heap
+        Compare comp;
+
+        // growth policy applied to nodes on push (see growth_policy above)
+        growth_policy growth = growth_policy::vector_default;
+
+#ifdef HEAP_STATS
+        // collected operation counters; the member only exists when the flag is on
+        stats_t heap_stats;
+#endif
+
+        // instrumentation hooks. Call sites pass plain locals that the optimizer strips
+        // together with these empty bodies when HEAP_STATS is off.
+        void stat_count_push(const bool reallocated) noexcept {
+#ifdef HEAP_STATS
+            heap_stats.pushes++;
+            heap_stats.reallocations += reallocated ? 1 : 0;
+#else
+            (void)reallocated;
+#endif
+        }
+
+        void stat_count_pop() noexcept {
+#ifdef HEAP_STATS
+            heap_stats.pops++;
+#endif
+        }
+
+        // used by the layers with a key-update operation (e.g. PriorityQueue)
+        void stat_count_update() noexcept {
+#ifdef HEAP_STATS
+            heap_stats.updates++;
+#endif
+        }
+
+        // record one finished sift: how many levels the element moved, and how many
+        // comparator invocations and node moves the walk cost
+        void stat_count_sift(const std::size_t depth, const std::size_t comparisons) noexcept {
+#ifdef HEAP_STATS
+            heap_stats.comparisons += comparisons;
+            heap_stats.node_moves += depth;
+            heap_stats.sift_depth[std::min(depth, heap_stats.sift_depth.size() - 1)]++;
+#else
+            (void)depth;
+            (void)comparisons;
+#endif
+        }
+
+        // pre-grow nodes according to the configured growth policy when the next push
+        // would trigger a reallocation, overriding the vector's default geometric growth
+        void grow_for_push() {
+            if (growth == growth_policy::vector_default || nodes.size() < nodes.capacity()) {
+                return;
+            }
+
+            const std::size_t needed = nodes.size() + 1;
+
+            switch (growth) {
+                case growth_policy::exact:
+                    nodes.reserve(needed);
+                    break;
+                case growth_policy::one_point_five:
+                    nodes.reserve(std::max(needed, nodes.size() + nodes.size() / 2));
+                    break;
+                case growth_policy::power_of_two: {
+                    std::size_t capacity = 1;
+                    while (capacity < needed) {
+                        capacity <<= 1;
+                    }
+                    nodes.reserve(capacity);
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+
+        // return *this statically cast to the most-derived heap class
+        [[nodiscard]] Derived& self() noexcept {
+            return static_cast<Derived&>(*this);
+        }
+
+        [[nodiscard]] const Derived& self() const noexcept {
+            return static_cast<const Derived&>(*this);
+        }
+
+        // protected constructor to let the subclass set the comparator after the initialization.
+        // Compare must be default constructible on this path.
+        explicit Heap(const std::vector<T>& inputs) noexcept : nodes(make_container(inputs)), comp() {
+        }
+
+        // protected constructor to let the subclass set the comparator after the initialization.
+        // Compare must be default constructible on this path.
+        explicit Heap(std::vector<T>&& inputs) noexcept :
+            nodes(make_container(std::move(inputs))), comp() {
+        }
+
+        // protected allocator-aware constructors, same contract as above
+        explicit Heap(const std::vector<T>& inputs, const Allocator& allocator) :
+            nodes(make_container(inputs, allocator)), comp() {
+        }
+
+        explicit Heap(std::vector<T>&& inputs, const Allocator& allocator) :
+            nodes(make_container(std::move(inputs), allocator)), comp() {
+        }
+
+        // swap 2 nodes in the heap. Derived classes (e.g. PriorityQueue) can shadow this
+        // to keep their auxiliary bookkeeping in sync; the shadowing definition is picked
+        // up statically through self().
+        void swap_nodes(std::size_t i, std::size_t j) noexcept {
+            std::swap(node_at(i), node_at(j));
+        }
+
+        // move the node at index src into the hole left at index dst during a sift.
+        // Derived classes (e.g. PriorityQueue) can shadow this to keep their auxiliary
+        // bookkeeping in sync with a single write per shifted node.
+        void shift_node(const std::size_t dst, const std::size_t src) noexcept {
+            node_at(dst) = std::move(node_at(src));
+        }
+
+        // write the element saved at the beginning of a sift into its final position.
+        // Derived classes (e.g. PriorityQueue) can shadow this.
+        void place_node(const std::size_t index, T&& value) noexcept {
+            node_at(index) = std::move(value);
         }
 
         // starting from a Heap with a misplaced node at the given index,
-        // recover the shape and heap properties in O(logN) bubbling the node up
+        // recover the shape and heap properties in O(logN) bubbling the node up.
+        // The moving element is saved once, the ancestors are shifted down into the
+        // hole it leaves behind, and the element is written a single time at its final
+        // position, instead of paying a full swap (3 writes) per level.
         void heapify_up(const std::size_t index_to_fix) noexcept {
+            const std::size_t root = Derived::layout_offset();
             std::size_t i = index_to_fix;
+            std::size_t depth = 0;
+            std::size_t comparisons = 0;
+            T moving = std::move(node_at(i));
 
-            while (i > 0 && comp(nodes.at(parent(i)), nodes.at(i))) {
-                const auto p = parent(i);
-                swap_nodes(i, p);
+            while (i > root) {
+                const auto p = self().parent(i);
+                comparisons++;
+                if (!comp(node_at(p), moving)) {
+                    break;
+                }
+                self().shift_node(i, p);
                 i = p;
+                depth++;
+            }
+
+            self().place_node(i, std::move(moving));
+            stat_count_sift(depth, comparisons);
+        }
+
+        // recover the heap property after a batch of elements has been appended at the end
+        // of nodes, starting from the given old size. For small batches each appended
+        // element is bubbled up individually (O(b*logN)); once the batch is big enough that
+        // b*log2(N) exceeds N, one Floyd build_heap() pass (O(N)) is cheaper.
+        // old_size is an index into nodes (i.e. it includes the layout padding)
+        void sift_appended(const std::size_t old_size) noexcept {
+            const std::size_t len = nodes.size();
+            const std::size_t appended = len - old_size;
+
+            if (appended == 0) {
+                return;
+            }
+
+            // integer approximation of log2(size())
+            std::size_t log_len = 1;
+            while ((std::size_t{1} << log_len) < size()) {
+                ++log_len;
+            }
+
+            if (appended * log_len >= size()) {
+                self().build_heap();
+            } else {
+                for (std::size_t i = old_size; i < len; ++i) {
+                    heapify_up(i);
+                }
             }
         }
 
@@ -69,7 +358,7 @@ namespace heap {
         // valid heap from the beginning
         void init() noexcept {
             if constexpr (!IsAlreadyHeap) {
-                build_heap();
+                self().build_heap();
             }
         }
 
@@ -77,20 +366,40 @@ namespace heap {
         // disable public default constructor
         Heap() = delete;
 
-        explicit Heap(const std::vector<T>& inputs, compare_t&& comp) noexcept :
-            nodes(inputs), comp(comp) {
+        explicit Heap(const std::vector<T>& inputs, Compare comp) noexcept :
+            nodes(make_container(inputs)), comp(std::move(comp)) {
+        }
+
+        explicit Heap(std::vector<T>&& inputs, Compare comp) noexcept :
+            nodes(make_container(std::move(inputs))), comp(std::move(comp)) {
+        }
+
+        // allocator-aware constructors: the given instance backs the node vector, so a
+        // whole heap can live inside one arena
+        explicit Heap(const std::vector<T>& inputs, Compare comp, const Allocator& allocator) :
+            nodes(make_container(inputs, allocator)), comp(std::move(comp)) {
         }
 
-        explicit Heap(std::vector<T>&& inputs, compare_t&& comp) noexcept :
-            nodes(inputs), comp(comp) {
+        explicit Heap(std::vector<T>&& inputs, Compare comp, const Allocator& allocator) :
+            nodes(make_container(std::move(inputs), allocator)), comp(std::move(comp)) {
         }
 
-        // virtual destructor because this is a base class
-        virtual ~Heap() = default;
+        ~Heap() = default;
 
         // return the number of elements in the heap
         [[nodiscard]] size_t size() const noexcept {
-            return nodes.size();
+            return nodes.size() - Derived::layout_offset();
+        }
+
+        // pre-size the backing vector for the given number of elements, so that loading
+        // a known workload doesn't pay repeated reallocations
+        void reserve(const std::size_t capacity) {
+            nodes.reserve(capacity + Derived::layout_offset());
+        }
+
+        // select the growth policy applied to the backing vector on push
+        void set_growth_policy(const growth_policy policy) noexcept {
+            growth = policy;
         }
 
         // return true iff the heap is empty
@@ -102,27 +411,235 @@ namespace heap {
         [[nodiscard]] const T& top() const {
             assert(size() > 0);
 
-            return nodes.at(0);
+            return node_at(Derived::layout_offset());
+        }
+
+        // return the collected operation counters (see stats_t). Without HEAP_STATS
+        // nothing is ever counted and a zeroed instance comes back.
+        [[nodiscard]] const stats_t& stats() const noexcept {
+#ifdef HEAP_STATS
+            return heap_stats;
+#else
+            static const stats_t zeroed{};
+            return zeroed;
+#endif
         }
 
         // remove the top element of the heap (which must exist)
         void pop() {
             assert(size() > 0);
 
+            stat_count_pop();
+
+            const std::size_t root = Derived::layout_offset();
+
             // replace root of the heap with the last element of the vector
-            nodes.at(0) = nodes.back();
+            node_at(root) = nodes.back();
 
             // remove the last element of the vector
             nodes.pop_back();
 
             // the root violates the heap property, so it must be fixed
-            heapify_down(0);
+            self().heapify_down(root);
+        }
+
+        // remove the top element of the heap (which must exist) and return it.
+        // The element is moved out instead of being discarded, so consumers that need
+        // the popped value don't pay a copy of T on top of the usual heapify_down
+        [[nodiscard]] T pop_top() {
+            assert(size() > 0);
+
+            stat_count_pop();
+
+            const std::size_t root = Derived::layout_offset();
+
+            // move the root out before overwriting it
+            T top_value = std::move(node_at(root));
+
+            // replace root of the heap with the last element of the vector
+            node_at(root) = std::move(nodes.back());
+
+            // remove the last element of the vector
+            nodes.pop_back();
+
+            // the root violates the heap property, so it must be fixed
+            self().heapify_down(root);
+
+            return top_value;
+        }
+
+        // overwrite the top element in place (the heap must not be empty) and restore
+        // the heap order with a single sift down. Streaming consumers that pop a record
+        // and immediately push its successor (e.g. k-way merges) pay one heapify_down
+        // here instead of the two full sifts of the pop()+push() idiom.
+        void replace_top(T&& element) {
+            assert(size() > 0);
+
+            stat_count_update();
+
+            const std::size_t root = Derived::layout_offset();
+            node_at(root) = std::move(element);
+            self().heapify_down(root);
+        }
+
+        void replace_top(const T& element) {
+            replace_top(T(element));
+        }
+
+        // transform the internal vector into a heap using up to num_threads worker
+        // threads (0 picks std::thread::hardware_concurrency()). Floyd's pass is run
+        // level-synchronized bottom-up: two sift-downs rooted on the same level touch
+        // disjoint subtrees, so every level can be split across threads with no
+        // synchronization beyond the per-level join. Small heaps fall back to the
+        // sequential build_heap(), where thread startup would dominate; so do
+        // HEAP_STATS builds, whose plain counters cannot be bumped from worker threads.
+        void build_heap_parallel(std::size_t num_threads = 0) {
+#ifdef HEAP_STATS
+            // every stat_count_sift() of the build would race on the shared counters
+            (void)num_threads;
+            self().build_heap();
+            return;
+#endif
+            // below this size the sequential pass wins against thread startup costs
+            constexpr std::size_t parallel_cutoff = std::size_t{1} << 15;
+
+            constexpr std::size_t arity = Derived::arity;
+            const std::size_t offset = Derived::layout_offset();
+            const std::size_t count = size();
+
+            if (num_threads == 0) {
+                num_threads = std::max(1u, std::thread::hardware_concurrency());
+            }
+
+            if (count < parallel_cutoff || num_threads == 1) {
+                self().build_heap();
+                return;
+            }
+
+            // logical index of the last node with at least one child
+            const std::size_t last_parent = (count - 2) / arity;
+
+            // logical index of the first node of each level that contains parents
+            std::vector<std::size_t> level_first{0};
+            while (level_first.back() * arity + 1 <= last_parent) {
+                level_first.emplace_back(level_first.back() * arity + 1);
+            }
+
+            std::vector<std::thread> workers;
+            workers.reserve(num_threads - 1);
+
+            for (std::size_t level = level_first.size(); level-- > 0;) {
+                const std::size_t first = level_first[level];
+                const std::size_t last =
+                    std::min(first * arity, last_parent);  // inclusive, == first * arity + 1 - 1
+                const std::size_t level_count = last - first + 1;
+
+                // narrow levels near the root aren't worth fanning out
+                if (level_count < 4 * num_threads) {
+                    for (std::size_t i = first; i <= last; ++i) {
+                        self().heapify_down(i + offset);
+                    }
+                    continue;
+                }
+
+                const std::size_t chunk = (level_count + num_threads - 1) / num_threads;
+
+                for (std::size_t worker = 1; worker < num_threads; ++worker) {
+                    const std::size_t begin = first + worker * chunk;
+                    const std::size_t end = std::min(begin + chunk, last + 1);
+
+                    if (begin >= end) {
+                        break;
+                    }
+
+                    workers.emplace_back([this, begin, end, offset] {
+                        for (std::size_t i = begin; i < end; ++i) {
+                            self().heapify_down(i + offset);
+                        }
+                    });
+                }
+
+                for (std::size_t i = first; i < std::min(first + chunk, last + 1); ++i) {
+                    self().heapify_down(i + offset);
+                }
+
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+                workers.clear();
+            }
+        }
+
+        // absorb every element of other into this heap, leaving other empty. The node
+        // vectors are concatenated with a single reservation and the heap property is
+        // recovered once at the end (one O(n) build_heap() pass when other is large),
+        // instead of paying a full push() per melded element.
+        void meld(Heap&& other) {
+            const std::size_t old_size = nodes.size();
+            const std::size_t offset = Derived::layout_offset();
+
+            nodes.reserve(old_size + other.size());
+            nodes.insert(nodes.end(), std::make_move_iterator(other.nodes.begin() + offset),
+                         std::make_move_iterator(other.nodes.end()));
+            other.nodes.erase(other.nodes.begin() + offset, other.nodes.end());
+
+            sift_appended(old_size);
+        }
+
+        // sort the stored elements in pop order (ascending for a Min Heap, descending
+        // for a Max Heap) and move them out, leaving the heap empty. Classic in-place
+        // heapsort: the root is swapped with the last element of a shrinking prefix and
+        // the new root is sifted down within that prefix, all on the internal vector
+        // without the per-element call and bounds-check overhead of a top()/pop() loop;
+        // a final O(n) reverse turns the result into pop order.
+        [[nodiscard]] std::vector<T> sort() {
+            const std::size_t root = Derived::layout_offset();
+
+            for (std::size_t end = nodes.size(); end > root + 1; --end) {
+                self().swap_nodes(root, end - 1);
+                self().heapify_down(root, end - 1);
+            }
+
+            std::vector<T> result;
+
+            if constexpr (std::is_same_v<container_type, std::vector<T>> &&
+                          Derived::layout_offset() == 0) {
+                // the backing vector can be handed over wholesale
+                result = std::move(nodes);
+                nodes.clear();
+            } else {
+                result.assign(std::make_move_iterator(nodes.begin() + root),
+                              std::make_move_iterator(nodes.end()));
+                nodes.erase(nodes.begin() + root, nodes.end());
+            }
+
+            std::reverse(result.begin(), result.end());
+
+            return result;
+        }
+
+        // add a batch of new elements to the heap in one go. The batch is appended with a
+        // single reservation and the heap property is recovered once at the end, which is
+        // much cheaper than one heapify_up per element for bursty insertion workloads
+        void push_range(std::vector<T>&& inputs) {
+            const std::size_t old_size = nodes.size();
+
+            nodes.reserve(old_size + inputs.size());
+            for (auto& input : inputs) {
+                nodes.emplace_back(std::move(input));
+            }
+
+            sift_appended(old_size);
         }
 
         // add a new element to the heap
         template <class... Args>
         void push(Args&&... args) {
-            const size_t index_to_fix = size();
+            grow_for_push();
+
+            stat_count_push(nodes.size() == nodes.capacity());
+
+            const size_t index_to_fix = nodes.size();
 
             // insert new node at the end of the vector
             nodes.emplace_back(std::forward<Args>(args)...);
@@ -134,4 +651,4 @@ namespace heap {
 
 }  // namespace heap
 
-#endif  // HEAP_H
\ No newline at end of file
+#endif  // HEAP_H
@@ -0,0 +1,430 @@
+#ifndef INDEXED_PRIORITY_QUEUE_H
+#define INDEXED_PRIORITY_QUEUE_H
+
+#include <algorithm>    // std::swap, std::max_element
+#include <cassert>      // std::assert
+#include <limits>       // std::numeric_limits
+#include <type_traits>  // std::conditional_t, std::is_integral
+#include <utility>      // std::move, std::pair
+#include <vector>       // std::vector
+
+#include "BinaryHeap.h"
+#include "Heap.h"
+#include "KHeap.h"
+#include "PriorityQueue.h"
+
+namespace priority_queue {
+
+    namespace detail {
+
+        // stateful comparison functor that orders elements by their key, Min Heap flavor.
+        // Keys live in a flat std::vector indexed by the element id itself, so every
+        // comparison is two O(1) array lookups instead of two hash probes.
+        template <typename KeyVector>
+        class indexed_min_compare {
+            const KeyVector* keys = nullptr;
+
+        public:
+            indexed_min_compare() = default;
+
+            explicit indexed_min_compare(const KeyVector& keys) noexcept : keys(&keys) {
+            }
+
+            template <typename U>
+            [[nodiscard]] bool operator()(const U& a, const U& b) const {
+                return (*keys)[static_cast<std::size_t>(a)] > (*keys)[static_cast<std::size_t>(b)];
+            }
+        };
+
+        // stateful comparison functor that orders elements by their key, Max Heap flavor.
+        template <typename KeyVector>
+        class indexed_max_compare {
+            const KeyVector* keys = nullptr;
+
+        public:
+            indexed_max_compare() = default;
+
+            explicit indexed_max_compare(const KeyVector& keys) noexcept : keys(&keys) {
+            }
+
+            template <typename U>
+            [[nodiscard]] bool operator()(const U& a, const U& b) const {
+                return (*keys)[static_cast<std::size_t>(a)] < (*keys)[static_cast<std::size_t>(b)];
+            }
+        };
+
+    }  // namespace detail
+
+    /**
+     * Priority Queue specialized for dense integral element ids (e.g. graph vertexes in
+     * Dijkstra/Prim). Keys and heap positions are stored in flat std::vectors indexed by the
+     * element id, so the two unordered_map lookups that PriorityQueue pays on every sift step
+     * (and the two key_map lookups per comparison) become O(1) array accesses.
+     * This class shouldn't be invoked directly.
+     * Instead, the factories make_min_indexed_priority_queue, make_max_indexed_priority_queue,
+     * make_min_indexed_k_priority_queue, make_max_indexed_k_priority_queue should be used.
+     *
+     * Heap: type of the parent class of IndexedPriorityQueue. It must derive heap::Heap.
+     * Key: type of the keys used to order the Heap.
+     * T: integral type of the element ids stored in the Heap. Ids should be dense, as the
+     *    internal vectors are sized to the biggest id seen so far.
+     * IsAlreadyHeap: constexpr flag. If true, build_heap() won't be called after the class is
+     *                constructed. If false, the given input is considered an already valid heap
+     *                according to its keys.
+     * HeapType: enum utility used to understand whether Heap is a Min Heap or a Max Heap.
+     */
+    template <class Heap, typename Key, typename T, bool IsAlreadyHeap = false,
+              Type HeapType = Type::min_heap>
+    class IndexedPriorityQueue
+        : private Heap::template rebind<
+              std::conditional_t<HeapType == Type::min_heap,
+                                 detail::indexed_min_compare<std::vector<Key>>,
+                                 detail::indexed_max_compare<std::vector<Key>>>,
+              IndexedPriorityQueue<Heap, Key, T, IsAlreadyHeap, HeapType>> {
+        static_assert(std::is_integral<T>::value,
+                      "IndexedPriorityQueue requires integral element ids");
+
+        // concrete comparator type that orders the heap by key, selected at compile time
+        // according to the heap flavor
+        using compare_type = std::conditional_t<HeapType == Type::min_heap,
+                                                detail::indexed_min_compare<std::vector<Key>>,
+                                                detail::indexed_max_compare<std::vector<Key>>>;
+
+        using super = typename Heap::template rebind<compare_type, IndexedPriorityQueue>;
+
+        // the heap classes reach the protected members of this class through self()
+        friend super;
+        friend class heap::Heap<IndexedPriorityQueue, T, compare_type, IsAlreadyHeap>;
+
+        // sentinel stored in positions for elements that are not in the queue
+        static constexpr std::size_t absent = std::numeric_limits<std::size_t>::max();
+
+        // keys[element] -> key assigned to element
+        std::vector<Key> keys;
+
+        // positions[element] -> index in this->nodes of element, or absent
+        std::vector<std::size_t> positions;
+
+        // index of the given element in keys/positions
+        [[nodiscard]] static std::size_t id(const T& element) noexcept {
+            assert(element >= 0);
+            return static_cast<std::size_t>(element);
+        }
+
+        // grow keys and positions so that the given element id is addressable
+        void ensure_addressable(const T& element) {
+            if (id(element) >= positions.size()) {
+                keys.resize(id(element) + 1);
+                positions.resize(id(element) + 1, absent);
+            }
+        }
+
+        // initialize keys and positions from the parallel input vectors
+        void init(const std::vector<Key>& input_keys) {
+            assert(input_keys.size() == this->nodes.size());
+
+            std::size_t index = 0;
+            for (const auto& node : this->nodes) {
+                ensure_addressable(node);
+                keys[id(node)] = input_keys[index];
+                positions[id(node)] = index;
+                index++;
+            }
+
+            // set comparator in base class after initialization of keys, because member
+            // objects can only be initialized after the parent class is completely initialized
+            this->comp = compare_type(keys);
+            super::init();
+        }
+
+    protected:
+        void swap_nodes(std::size_t i, std::size_t j) noexcept {
+            // swap the positions, two O(1) array lookups
+            std::swap(positions[id(this->node_at(i))], positions[id(this->node_at(j))]);
+
+            // swap the nodes
+            super::swap_nodes(i, j);
+        }
+
+        // hole-based sift support: a shifted node needs a single position update
+        void shift_node(const std::size_t dst, const std::size_t src) noexcept {
+            super::shift_node(dst, src);
+            positions[id(this->node_at(dst))] = dst;
+        }
+
+        // hole-based sift support: the saved element is indexed once, at its final position
+        void place_node(const std::size_t index, T&& value) noexcept {
+            positions[id(value)] = index;
+            super::place_node(index, std::move(value));
+        }
+
+    public:
+        IndexedPriorityQueue() = delete;
+
+        explicit IndexedPriorityQueue(const std::vector<Key>& input_keys,
+                                      const std::vector<T>& inputs) :
+            super(inputs) {
+            init(input_keys);
+        }
+
+        explicit IndexedPriorityQueue(std::vector<Key>&& input_keys, std::vector<T>&& inputs) :
+            super(std::move(inputs)) {
+            init(input_keys);
+        }
+
+        ~IndexedPriorityQueue() = default;
+
+        // return the number of elements in the heap.
+        // Time: O(1).
+        // Space: O(1).
+        [[nodiscard]] std::size_t size() const noexcept {
+            return super::size();
+        }
+
+        // return true iff the heap is empty.
+        // Time: O(1).
+        // Space: O(1).
+        [[nodiscard]] bool empty() const noexcept {
+            return super::empty();
+        }
+
+        // pre-size the heap vector for the given number of elements, and the flat
+        // key/position vectors for element ids up to max_element included
+        void reserve(const std::size_t capacity, const T& max_element) {
+            super::reserve(capacity);
+            ensure_addressable(max_element);
+        }
+
+        // select the growth policy applied to the heap vector on push
+        void set_growth_policy(const heap::growth_policy policy) noexcept {
+            super::set_growth_policy(policy);
+        }
+
+        // add a new element to the heap and associates the given key to it.
+        // Time: O(logN) amortized if using BinaryHeap, O(k*log_k(N)) amortized instead.
+        // Space: O(1) amortized.
+        void push(const Key& key, const T& element) {
+            ensure_addressable(element);
+            assert(positions[id(element)] == absent);
+
+            const std::size_t index_to_fix = this->size();
+            positions[id(element)] = index_to_fix;
+            keys[id(element)] = key;
+
+            super::push(element);
+        }
+
+        // add a batch of key/element pairs to the heap in one go. The flat vectors are
+        // grown once, the elements are appended with a single reservation, and the heap
+        // property is recovered once at the end: one heapify_up per element for small
+        // batches, a single build_heap() when the batch rivals the heap size.
+        // Time: O(min(b*logN, N + b)) amortized, for a batch of b elements.
+        // Space: O(b) amortized.
+        void push_bulk(std::vector<Key>&& input_keys, std::vector<T>&& elements) {
+            assert(input_keys.size() == elements.size());
+
+            const std::size_t old_size = this->size();
+
+            this->nodes.reserve(old_size + elements.size());
+
+            std::size_t index = old_size;
+            for (const auto& element : elements) {
+                ensure_addressable(element);
+                assert(positions[id(element)] == absent);
+
+                positions[id(element)] = index;
+                keys[id(element)] = std::move(input_keys[index - old_size]);
+                this->nodes.emplace_back(element);
+                index++;
+            }
+
+            this->sift_appended(old_size);
+        }
+
+        // update the key of an element in the priority queue, in either direction.
+        // The element must exist in the priority queue.
+        // Time: O(logN) amortized if using BinaryHeap, O(k*log_k(N)) amortized instead.
+        // Space: O(1).
+        void update_key(const Key& key, const T& element) {
+            const std::size_t index_to_fix = positions[id(element)];
+            assert(index_to_fix != absent);
+
+            const Key old_key = std::move(keys[id(element)]);
+            keys[id(element)] = key;
+
+            // one comparison of the old key against the new one picks the sift
+            // direction, so an increase on a Min Heap (or a decrease on a Max Heap) is
+            // handled instead of leaving the node below children it no longer beats
+            if constexpr (HeapType == Type::min_heap) {
+                if (old_key > key) {
+                    this->heapify_up(index_to_fix);
+                } else {
+                    this->heapify_down(index_to_fix);
+                }
+            } else {
+                if (old_key < key) {
+                    this->heapify_up(index_to_fix);
+                } else {
+                    this->heapify_down(index_to_fix);
+                }
+            }
+        }
+
+        // return the value of the key of the given element.
+        // Time: O(1).
+        // Space: O(1).
+        [[nodiscard]] const Key& key_at(const T& element) const {
+            assert(contains(element));
+            return keys[id(element)];
+        }
+
+        // return true iff the given element is in the priority queue.
+        // Time: O(1).
+        // Space: O(1).
+        [[nodiscard]] bool contains(const T& element) const noexcept {
+            return id(element) < positions.size() && positions[id(element)] != absent;
+        }
+
+        // return the top element.
+        // Time: O(1).
+        // Space: O(1).
+        [[nodiscard]] const T& top() const {
+            return super::top();
+        }
+
+        // return top key-value pair.
+        // Time: O(1).
+        // Space: O(1).
+        [[nodiscard]] std::pair<const Key&, const T&> top_key_value() const {
+            const auto& top_value = super::top();
+            const auto& top_key = key_at(top_value);
+            return {top_key, top_value};
+        }
+
+        // remove the top key-value pair and return it.
+        // Time: O(logN) amortized if using BinaryHeap, O(k*log_k(N)) amortized instead.
+        // Space: O(1).
+        [[nodiscard]] std::pair<Key, T> pop_top() {
+            assert(this->size() > 0);
+
+            const T top_value = this->node_at(0);
+            Key top_key = std::move(keys[id(top_value)]);
+
+            positions[id(top_value)] = absent;
+
+            // replace root of the heap with the last element of the vector
+            this->node_at(0) = this->nodes.back();
+
+            // remove the last element of the vector
+            this->nodes.pop_back();
+
+            // no need to recover the heap property if the heap is empty
+            if (this->size() > 0) {
+                positions[id(this->nodes.front())] = 0;
+
+                // the root violates the heap property. Let's fix that
+                this->heapify_down(0);
+            }
+
+            return {std::move(top_key), top_value};
+        }
+
+        // remove the top element.
+        // Time: O(logN) amortized if using BinaryHeap, O(k*log_k(N)) amortized instead.
+        // Space: O(1).
+        void pop() {
+            assert(this->size() > 0);
+
+            positions[id(this->node_at(0))] = absent;
+
+            // replace root of the heap with the last element of the vector
+            this->node_at(0) = this->nodes.back();
+
+            // remove the last element of the vector
+            this->nodes.pop_back();
+
+            // no need to recover the heap property if the heap is empty
+            if (this->size() > 0) {
+                positions[id(this->nodes.front())] = 0;
+
+                // the root violates the heap property. Let's fix that
+                this->heapify_down(0);
+            }
+        }
+    };
+
+    // create an Indexed Priority Queue based on a Min Heap. It copies the given vectors.
+    template <bool IsAlreadyHeap = false, typename Key, typename Value>
+    auto make_min_indexed_priority_queue(const std::vector<Key>& keys,
+                                         const std::vector<Value>& inputs) {
+        using pq = IndexedPriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap>, Key, Value,
+                                        IsAlreadyHeap, Type::min_heap>;
+        return pq(keys, inputs);
+    }
+
+    // create an Indexed Priority Queue based on a Min Heap. It moves the given vectors.
+    template <bool IsAlreadyHeap = false, typename Key, typename Value>
+    auto make_min_indexed_priority_queue(std::vector<Key>&& keys = {},
+                                         std::vector<Value>&& inputs = {}) {
+        using pq = IndexedPriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap>, Key, Value,
+                                        IsAlreadyHeap, Type::min_heap>;
+        return pq(std::move(keys), std::move(inputs));
+    }
+
+    // create an Indexed Priority Queue based on a Max Heap. It copies the given vectors.
+    template <bool IsAlreadyHeap = false, typename Key, typename Value>
+    auto make_max_indexed_priority_queue(const std::vector<Key>& keys,
+                                         const std::vector<Value>& inputs) {
+        using pq = IndexedPriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap>, Key, Value,
+                                        IsAlreadyHeap, Type::max_heap>;
+        return pq(keys, inputs);
+    }
+
+    // create an Indexed Priority Queue based on a Max Heap. It moves the given vectors.
+    template <bool IsAlreadyHeap = false, typename Key, typename Value>
+    auto make_max_indexed_priority_queue(std::vector<Key>&& keys = {},
+                                         std::vector<Value>&& inputs = {}) {
+        using pq = IndexedPriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap>, Key, Value,
+                                        IsAlreadyHeap, Type::max_heap>;
+        return pq(std::move(keys), std::move(inputs));
+    }
+
+    // create an Indexed Priority Queue based on a Min K-Heap. It copies the given vectors.
+    template <std::size_t K, bool IsAlreadyHeap = false, typename Key, typename Value>
+    auto make_min_indexed_k_priority_queue(const std::vector<Key>& keys,
+                                           const std::vector<Value>& inputs) {
+        using pq = IndexedPriorityQueue<heap::KHeap<K, Value, IsAlreadyHeap>, Key, Value,
+                                        IsAlreadyHeap, Type::min_heap>;
+        return pq(keys, inputs);
+    }
+
+    // create an Indexed Priority Queue based on a Min K-Heap. It moves the given vectors.
+    template <std::size_t K, bool IsAlreadyHeap = false, typename Key, typename Value>
+    auto make_min_indexed_k_priority_queue(std::vector<Key>&& keys = {},
+                                           std::vector<Value>&& inputs = {}) {
+        using pq = IndexedPriorityQueue<heap::KHeap<K, Value, IsAlreadyHeap>, Key, Value,
+                                        IsAlreadyHeap, Type::min_heap>;
+        return pq(std::move(keys), std::move(inputs));
+    }
+
+    // create an Indexed Priority Queue based on a Max K-Heap. It copies the given vectors.
+    template <std::size_t K, bool IsAlreadyHeap = false, typename Key, typename Value>
+    auto make_max_indexed_k_priority_queue(const std::vector<Key>& keys,
+                                           const std::vector<Value>& inputs) {
+        using pq = IndexedPriorityQueue<heap::KHeap<K, Value, IsAlreadyHeap>, Key, Value,
+                                        IsAlreadyHeap, Type::max_heap>;
+        return pq(keys, inputs);
+    }
+
+    // create an Indexed Priority Queue based on a Max K-Heap. It moves the given vectors.
+    template <std::size_t K, bool IsAlreadyHeap = false, typename Key, typename Value>
+    auto make_max_indexed_k_priority_queue(std::vector<Key>&& keys = {},
+                                           std::vector<Value>&& inputs = {}) {
+        using pq = IndexedPriorityQueue<heap::KHeap<K, Value, IsAlreadyHeap>, Key, Value,
+                                        IsAlreadyHeap, Type::max_heap>;
+        return pq(std::move(keys), std::move(inputs));
+    }
+
+}  // namespace priority_queue
+
+#endif  // INDEXED_PRIORITY_QUEUE_H
@@ -1,13 +1,163 @@
 #ifndef K_HEAP_H
 #define K_HEAP_H
 
+#include <functional>   // std::greater, std::less
+#include <memory>       // std::allocator
+#include <new>          // std::align_val_t, ::operator new
 #include <type_traits>  // std::enable_if
+#include <utility>      // std::index_sequence, std::make_index_sequence
 #include <vector>       // std::vector
 
 #include "Heap.h"
 
+#if defined(__AVX2__)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+#endif
+
 namespace heap {
 
+    namespace detail {
+
+        // assumed size of a cache line, in bytes
+        inline constexpr std::size_t cache_line_size = 64;
+
+        // minimal allocator that over-aligns every allocation to the cache line size,
+        // so that the K-children groups of the cache-aligned KHeap layout start exactly
+        // on cache line boundaries
+        template <typename T>
+        struct cache_aligned_allocator {
+            using value_type = T;
+
+            cache_aligned_allocator() = default;
+
+            template <typename U>
+            cache_aligned_allocator(const cache_aligned_allocator<U>&) noexcept {
+            }
+
+            [[nodiscard]] T* allocate(const std::size_t n) {
+                return static_cast<T*>(
+                    ::operator new(n * sizeof(T), std::align_val_t{cache_line_size}));
+            }
+
+            void deallocate(T* pointer, std::size_t) noexcept {
+                ::operator delete(pointer, std::align_val_t{cache_line_size});
+            }
+
+            template <typename U>
+            [[nodiscard]] bool operator==(const cache_aligned_allocator<U>&) const noexcept {
+                return true;
+            }
+
+            template <typename U>
+            [[nodiscard]] bool operator!=(const cache_aligned_allocator<U>&) const noexcept {
+                return false;
+            }
+        };
+
+#if defined(__AVX2__)
+
+        // index of the lowest set bit of a non-zero mask
+        inline std::size_t first_set_bit(const unsigned mask) noexcept {
+#if defined(_MSC_VER)
+            unsigned long index = 0;
+            _BitScanForward(&index, mask);
+            return index;
+#else
+            return static_cast<std::size_t>(__builtin_ctz(mask));
+#endif
+        }
+
+        // index (0..7) of the smallest of 8 contiguous int32 values.
+        // Ties resolve to the lowest index, like the scalar scan.
+        inline std::size_t argmin8_epi32(const int* values) noexcept {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+
+            // tournament reduction: every lane ends up holding the global minimum
+            __m256i m = _mm256_min_epi32(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+            m = _mm256_min_epi32(m, _mm256_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+            m = _mm256_min_epi32(m, _mm256_permute2x128_si256(m, m, 1));
+
+            const __m256i eq = _mm256_cmpeq_epi32(v, m);
+            const auto mask =
+                static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(eq)));
+            return first_set_bit(mask);
+        }
+
+        // index (0..7) of the biggest of 8 contiguous int32 values.
+        // Ties resolve to the lowest index, like the scalar scan.
+        inline std::size_t argmax8_epi32(const int* values) noexcept {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+
+            __m256i m = _mm256_max_epi32(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+            m = _mm256_max_epi32(m, _mm256_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+            m = _mm256_max_epi32(m, _mm256_permute2x128_si256(m, m, 1));
+
+            const __m256i eq = _mm256_cmpeq_epi32(v, m);
+            const auto mask =
+                static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(eq)));
+            return first_set_bit(mask);
+        }
+
+        // flipping the sign bit maps unsigned 64-bit values onto the signed order, so
+        // the signed-only cmpgt of AVX2 can compare them
+        inline __m256i bias_epu64(const __m256i v) noexcept {
+            return _mm256_xor_si256(
+                v, _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ULL)));
+        }
+
+        // index (0..3) of the smallest of 4 contiguous 64-bit values. AVX2 has no
+        // 64-bit min, so the tournament runs on cmpgt + blend; IsSigned false biases
+        // the values first (see bias_epu64), which covers uint64 timestamp keys.
+        // Ties resolve to the lowest index, like the scalar scan.
+        template <bool IsSigned>
+        inline std::size_t argmin4_epi64(const long long* values) noexcept {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+
+            if constexpr (!IsSigned) {
+                v = bias_epu64(v);
+            }
+
+            // tournament reduction: every lane ends up holding the global minimum
+            __m256i r = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(2, 3, 0, 1));
+            __m256i m = _mm256_blendv_epi8(v, r, _mm256_cmpgt_epi64(v, r));
+            r = _mm256_permute4x64_epi64(m, _MM_SHUFFLE(1, 0, 3, 2));
+            m = _mm256_blendv_epi8(m, r, _mm256_cmpgt_epi64(m, r));
+
+            const __m256i eq = _mm256_cmpeq_epi64(v, m);
+            const auto mask =
+                static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(eq)));
+            return first_set_bit(mask);
+        }
+
+        // index (0..3) of the biggest of 4 contiguous 64-bit values.
+        // Ties resolve to the lowest index, like the scalar scan.
+        template <bool IsSigned>
+        inline std::size_t argmax4_epi64(const long long* values) noexcept {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+
+            if constexpr (!IsSigned) {
+                v = bias_epu64(v);
+            }
+
+            __m256i r = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(2, 3, 0, 1));
+            __m256i m = _mm256_blendv_epi8(r, v, _mm256_cmpgt_epi64(v, r));
+            r = _mm256_permute4x64_epi64(m, _MM_SHUFFLE(1, 0, 3, 2));
+            m = _mm256_blendv_epi8(r, m, _mm256_cmpgt_epi64(m, r));
+
+            const __m256i eq = _mm256_cmpeq_epi64(v, m);
+            const auto mask =
+                static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(eq)));
+            return first_set_bit(mask);
+        }
+
+#endif  // defined(__AVX2__)
+
+    }  // namespace detail
+
     /**
      * Generic K-ary Heap implementation. Depending on the given comparator function, it can
      * either be a Min K-ary Heap or a Max K-ary Heap.
@@ -19,70 +169,268 @@ namespace heap {
      * IsAlreadyHeap: constexpr bool flag. If true, build_heap() won't be called
      *                the class is constructed.
      *                If false, the given vector is considered an already valid heap.
+     * Compare: type of the comparison functor, stored inline in the Heap base.
+     *          std::greater<T> yields a Min Heap, std::less<T> a Max Heap.
+     * CacheAligned: if true, the backing vector is over-aligned to the cache line size and
+     *               K - 1 padding slots are kept in front of the root, so that every group
+     *               of K siblings starts exactly on a cache line boundary (pick K such that
+     *               K * sizeof(T) is a multiple of the cache line size). T must be default
+     *               constructible. The whole index arithmetic below folds back to the
+     *               classic formulas when CacheAligned is false.
+     * Derived: the most-derived class of the CRTP chain, or void if KHeap itself is
+     *          the most-derived class. Classes extending KHeap (e.g. PriorityQueue)
+     *          pass themselves here so that the Heap base dispatches statically to them.
+     * Allocator: allocator backing the node vector, e.g. an arena that reclaims the
+     *            whole heap in O(1) when it is discarded. Ignored when CacheAligned is
+     *            true, which forces the cache_aligned_allocator.
      */
     template <std::size_t K, typename T, bool IsAlreadyHeap = false,
+              typename Compare = std::greater<T>, bool CacheAligned = false,
+              typename Derived = void, typename Allocator = std::allocator<T>,
               typename = typename std::enable_if<(K > 2)>::type>
-    class KHeap : public Heap<T, IsAlreadyHeap> {
-        using super = Heap<T, IsAlreadyHeap>;
+    class KHeap
+        : public Heap<
+              detail::crtp_self_t<
+                  Derived, KHeap<K, T, IsAlreadyHeap, Compare, CacheAligned, Derived, Allocator>>,
+              T, Compare, IsAlreadyHeap,
+              std::conditional_t<CacheAligned, detail::cache_aligned_allocator<T>, Allocator>> {
+        using self_type = detail::crtp_self_t<Derived, KHeap>;
+        using super =
+            Heap<self_type, T, Compare, IsAlreadyHeap,
+                 std::conditional_t<CacheAligned, detail::cache_aligned_allocator<T>, Allocator>>;
 
-        // returns the j-th child of the i-th node.
+        // the Heap base invokes parent(), build_heap() and heapify_down() through self()
+        friend super;
+
+        // returns the j-th child of the i-th node. With the cache-aligned layout the
+        // K - 1 front padding slots make every group of K siblings start at a multiple
+        // of K, i.e. on a cache line boundary.
         [[nodiscard]] static size_t child(const size_t i, const size_t j) noexcept {
-            return (K * i) + j + 1;
+            return K * (i - layout_offset()) + j + 1 + layout_offset();
         }
 
         // returns true iff the i-th is a leaf
         [[nodiscard]] bool is_leaf(const size_t i) const noexcept {
-            return i > ((this->size() - 2) / K);
+            return (i - layout_offset()) > ((this->size() - 2) / K);
         }
 
+        // true iff the child scan of heapify_down can use a SIMD argmin/argmax kernel:
+        // the siblings must be contiguous plain integers under the plain
+        // std::greater/std::less ordering — 32-bit ints in blocks of 8, or 64-bit
+        // integers (signed or unsigned, e.g. uint64 timestamps) in blocks of 4
+#if defined(__AVX2__)
+        static constexpr bool use_simd_epi32 =
+            (K % 8 == 0) && std::is_same_v<T, int> &&
+            (std::is_same_v<Compare, std::greater<int>> || std::is_same_v<Compare, std::less<int>>);
+        static constexpr bool use_simd_epi64 =
+            (K % 4 == 0) && std::is_integral_v<T> && sizeof(T) == 8 &&
+            (std::is_same_v<Compare, std::greater<T>> || std::is_same_v<Compare, std::less<T>>);
+        static constexpr bool use_simd_child_select = use_simd_epi32 || use_simd_epi64;
+#else
+        static constexpr bool use_simd_child_select = false;
+#endif
+
+        // scalar scan: index of the winning child among [first, first + K) & < len.
+        // The winning child is the biggest in a Max Heap, the smallest in a Min Heap.
+        // K is a compile-time constant, so the sibling offsets are expanded by a fold
+        // expression instead of a runtime loop: no induction variable, no loop-exit
+        // branch, and the compiler can schedule the K-1 comparisons freely.
+        // Time: O(K)
+        [[nodiscard]] std::size_t select_child(const std::size_t first,
+                                               const std::size_t len) const noexcept {
+            return select_child_unrolled(first, len, std::make_index_sequence<K - 1>{});
+        }
+
+        template <std::size_t... Offsets>
+        [[nodiscard]] std::size_t select_child_unrolled(
+            const std::size_t first, const std::size_t len,
+            std::index_sequence<Offsets...>) const noexcept {
+            std::size_t comp_est = first;
+
+            // the len guard only fails for the last, partial sibling group
+            (([&] {
+                 const std::size_t son = first + Offsets + 1;
+                 if (son < len && this->comp(this->node_at(comp_est), this->node_at(son))) {
+                     comp_est = son;
+                 }
+             }()),
+             ...);
+
+            return comp_est;
+        }
+
+        // SIMD scan over a full group of K siblings, in blocks of 8 int32 values or
+        // 4 int64/uint64 values
+        [[nodiscard]] std::size_t select_child_simd(const std::size_t first) const noexcept {
+#if defined(__AVX2__)
+            if constexpr (use_simd_epi64) {
+                const auto* group =
+                    reinterpret_cast<const long long*>(this->nodes.data() + first);
+
+                const auto block_winner = [&](const std::size_t block) {
+                    if constexpr (std::is_same_v<Compare, std::greater<T>>) {
+                        return first + block +
+                               detail::argmin4_epi64<std::is_signed_v<T>>(group + block);
+                    } else {
+                        return first + block +
+                               detail::argmax4_epi64<std::is_signed_v<T>>(group + block);
+                    }
+                };
+
+                std::size_t comp_est = block_winner(0);
+                for (std::size_t block = 4; block < K; block += 4) {
+                    const auto candidate = block_winner(block);
+                    if (this->comp(this->node_at(comp_est), this->node_at(candidate))) {
+                        comp_est = candidate;
+                    }
+                }
+
+                return comp_est;
+            } else {
+                const int* group = this->nodes.data() + first;
+
+                const auto block_winner = [&](const std::size_t block) {
+                    if constexpr (std::is_same_v<Compare, std::greater<int>>) {
+                        return first + block + detail::argmin8_epi32(group + block);
+                    } else {
+                        return first + block + detail::argmax8_epi32(group + block);
+                    }
+                };
+
+                std::size_t comp_est = block_winner(0);
+                for (std::size_t block = 8; block < K; block += 8) {
+                    const auto candidate = block_winner(block);
+                    if (this->comp(this->node_at(comp_est), this->node_at(candidate))) {
+                        comp_est = candidate;
+                    }
+                }
+
+                return comp_est;
+            }
+#else
+            return select_child(first, first + K);
+#endif
+        }
+
+    public:
+        // allow classes extending KHeap to rebind the CRTP chain to themselves,
+        // possibly with their own comparator type
+        template <typename C, typename D>
+        using rebind = KHeap<K, T, IsAlreadyHeap, C, CacheAligned, D, Allocator>;
+
     protected:
-        using compare_t = typename super::compare_t;
+        using compare_type = typename super::compare_type;
+
+        // number of padding slots kept at the front of nodes (see CacheAligned above)
+        [[nodiscard]] static constexpr std::size_t layout_offset() noexcept {
+            return CacheAligned ? K - 1 : 0;
+        }
 
         // protected constructor to let the subclass set the comparator after the initialization
         explicit KHeap(const std::vector<T>& inputs) noexcept : super(inputs) {
+            this->insert_layout_padding();
         }
 
         // protected constructor to let the subclass set the comparator after the initialization
         explicit KHeap(std::vector<T>&& inputs) noexcept : super(std::move(inputs)) {
+            this->insert_layout_padding();
+        }
+
+        // protected allocator-aware constructors, same contract as above
+        explicit KHeap(const std::vector<T>& inputs,
+                       const typename super::allocator_type& allocator) :
+            super(inputs, allocator) {
+            this->insert_layout_padding();
         }
 
+        explicit KHeap(std::vector<T>&& inputs, const typename super::allocator_type& allocator) :
+            super(std::move(inputs), allocator) {
+            this->insert_layout_padding();
+        }
+
+        // number of children per node, used by the level decomposition of the
+        // parallel build
+        static constexpr std::size_t arity = K;
+
         // return the parent of nodes[i]
-        [[nodiscard]] std::size_t parent(const std::size_t i) const noexcept final override {
-            return (i - 1) / K;
+        [[nodiscard]] std::size_t parent(const std::size_t i) const noexcept {
+            return (i - layout_offset() - 1) / K + layout_offset();
         }
 
         // starting from a Heap with a misplaced node at the given index,
         // recover the shape and heap properties bubbling the node down.
-        void heapify_down(const std::size_t index_to_fix) noexcept override {
-            const std::size_t len = this->size();
-            std::size_t i = index_to_fix;
+        // The moving element is saved once, the winning children are shifted up into the
+        // hole it leaves behind, and the element is written a single time at its final
+        // position, instead of paying a full swap (3 writes) per level.
+        void heapify_down(const std::size_t index_to_fix) noexcept {
+            heapify_down(index_to_fix, this->nodes.size());
+        }
 
-            // comp_est is the biggest element in a Max Heap,
-            // or the smallest element in a Min Heap
-            std::size_t comp_est = i;
+        // same as above, but only the first len physical slots of nodes (including the
+        // layout padding) take part in the heap. Used by heapsort, which shrinks the
+        // heap by one slot per extracted element.
+        void heapify_down(const std::size_t index_to_fix, const std::size_t len) noexcept {
+            if (index_to_fix >= len) {
+                return;
+            }
+
+            std::size_t i = index_to_fix;
+            std::size_t depth = 0;
+            std::size_t comparisons = 0;
+            T moving = std::move(this->node_at(i));
 
             while (!is_leaf(i)) {
-                // Time: O(K)
-                for (std::size_t j = 0; j < K; ++j) {
-                    const auto son = child(i, j);
-                    if (son < len && this->comp(this->nodes.at(comp_est), this->nodes.at(son))) {
-                        comp_est = son;
+                const auto first = child(i, 0);
+
+                if (first >= len) {
+                    break;
+                }
+
+                // counted as K per level: the K-1 comparisons of the child scan plus
+                // the comparison against the moving element below
+                comparisons += K;
+
+                // comp_est is the biggest child in a Max Heap,
+                // or the smallest child in a Min Heap. Time: O(K)
+                std::size_t comp_est;
+
+                if constexpr (use_simd_child_select) {
+                    // the SIMD kernel needs the whole group of K siblings in range
+                    comp_est = first + K <= len ? select_child_simd(first)
+                                                : select_child(first, len);
+                } else {
+                    comp_est = select_child(first, len);
+                }
+
+#if defined(__GNUC__) || defined(__clang__)
+                // fetch the winning child's own children while the comparison against
+                // the moving element is still in flight, so the memory latency of the
+                // next level overlaps with the current one
+                {
+                    const std::size_t next_first = child(comp_est, 0);
+                    if (next_first < len) {
+                        __builtin_prefetch(&this->node_at(next_first));
                     }
                 }
+#endif
 
-                if (i == comp_est) {
-                    return;
+                if (!this->comp(moving, this->node_at(comp_est))) {
+                    break;
                 }
 
-                this->swap_nodes(i, comp_est);
+                this->self().shift_node(i, comp_est);
                 i = comp_est;
+                depth++;
             }
+
+            this->self().place_node(i, std::move(moving));
+            this->stat_count_sift(depth, comparisons);
         }
 
         // transform the internal vector in a heap in O(n)
-        void build_heap() noexcept override final {
+        void build_heap() noexcept {
             for (std::size_t i = (this->size() / K) + 1; i > 0; --i) {
-                heapify_down(i - 1);
+                heapify_down(i - 1 + layout_offset());
             }
         }
 
@@ -90,43 +438,135 @@ namespace heap {
         // disable public default constructor
         KHeap() = delete;
 
-        explicit KHeap(const std::vector<T>& inputs, compare_t&& comp) noexcept :
+        explicit KHeap(const std::vector<T>& inputs, Compare comp) noexcept :
             super(inputs, std::move(comp)) {
+            this->insert_layout_padding();
             this->init();
         }
 
-        explicit KHeap(std::vector<T>&& inputs, compare_t&& comp) noexcept :
+        explicit KHeap(std::vector<T>&& inputs, Compare comp) noexcept :
             super(std::move(inputs), std::move(comp)) {
+            this->insert_layout_padding();
+            this->init();
+        }
+
+        // allocator-aware constructors: the given instance backs the node vector
+        explicit KHeap(const std::vector<T>& inputs, Compare comp,
+                       const typename super::allocator_type& allocator) :
+            super(inputs, std::move(comp), allocator) {
+            this->insert_layout_padding();
+            this->init();
+        }
+
+        explicit KHeap(std::vector<T>&& inputs, Compare comp,
+                       const typename super::allocator_type& allocator) :
+            super(std::move(inputs), std::move(comp), allocator) {
+            this->insert_layout_padding();
             this->init();
         }
 
-        virtual ~KHeap() = default;
+        ~KHeap() = default;
     };
 
     // create a Min K-Heap copying the input vector
     template <std::size_t K, bool IsAlreadyHeap = false, typename T>
     auto make_min_k_heap(const std::vector<T>& inputs) {
-        return KHeap<K, T, IsAlreadyHeap>(inputs, std::greater<>{});
+        return KHeap<K, T, IsAlreadyHeap>(inputs, std::greater<T>{});
     }
 
     // create a Min K-Heap moving the input vector
     template <std::size_t K, bool IsAlreadyHeap = false, typename T>
     auto make_min_k_heap(std::vector<T>&& inputs = {}) {
-        return KHeap<K, T, IsAlreadyHeap>(std::move(inputs), std::greater<>{});
+        return KHeap<K, T, IsAlreadyHeap>(std::move(inputs), std::greater<T>{});
     }
 
     // create a Max K-Heap copying the input vector
     template <std::size_t K, bool IsAlreadyHeap = false, typename T>
     auto make_max_k_heap(const std::vector<T>& inputs) {
-        return KHeap<K, T, IsAlreadyHeap>(inputs, std::less<>{});
+        return KHeap<K, T, IsAlreadyHeap, std::less<T>>(inputs, std::less<T>{});
     }
 
     // create a Max K-Heap moving the input vector
     template <std::size_t K, bool IsAlreadyHeap = false, typename T>
     auto make_max_k_heap(std::vector<T>&& inputs = {}) {
-        return KHeap<K, T, IsAlreadyHeap>(std::move(inputs), std::less<>{});
+        return KHeap<K, T, IsAlreadyHeap, std::less<T>>(std::move(inputs), std::less<T>{});
+    }
+
+    // create a Min K-Heap copying the input vector, backed by the given allocator
+    template <std::size_t K, bool IsAlreadyHeap = false, typename T, typename Allocator>
+    auto make_min_k_heap(const std::vector<T>& inputs, const Allocator& allocator) {
+        return KHeap<K, T, IsAlreadyHeap, std::greater<T>, false, void, Allocator>(
+            inputs, std::greater<T>{}, allocator);
+    }
+
+    // create a Min K-Heap moving the input vector, backed by the given allocator
+    template <std::size_t K, bool IsAlreadyHeap = false, typename T, typename Allocator>
+    auto make_min_k_heap(std::vector<T>&& inputs, const Allocator& allocator) {
+        return KHeap<K, T, IsAlreadyHeap, std::greater<T>, false, void, Allocator>(
+            std::move(inputs), std::greater<T>{}, allocator);
+    }
+
+    // create a Max K-Heap copying the input vector, backed by the given allocator
+    template <std::size_t K, bool IsAlreadyHeap = false, typename T, typename Allocator>
+    auto make_max_k_heap(const std::vector<T>& inputs, const Allocator& allocator) {
+        return KHeap<K, T, IsAlreadyHeap, std::less<T>, false, void, Allocator>(
+            inputs, std::less<T>{}, allocator);
+    }
+
+    // create a Max K-Heap moving the input vector, backed by the given allocator
+    template <std::size_t K, bool IsAlreadyHeap = false, typename T, typename Allocator>
+    auto make_max_k_heap(std::vector<T>&& inputs, const Allocator& allocator) {
+        return KHeap<K, T, IsAlreadyHeap, std::less<T>, false, void, Allocator>(
+            std::move(inputs), std::less<T>{}, allocator);
+    }
+
+    // create a cache-aligned Min K-Heap copying the input vector.
+    // Pick K such that K * sizeof(T) is a multiple of the cache line size.
+    template <std::size_t K, bool IsAlreadyHeap = false, typename T>
+    auto make_min_aligned_k_heap(const std::vector<T>& inputs) {
+        return KHeap<K, T, IsAlreadyHeap, std::greater<T>, true>(inputs, std::greater<T>{});
+    }
+
+    // create a cache-aligned Min K-Heap moving the input vector.
+    // Pick K such that K * sizeof(T) is a multiple of the cache line size.
+    template <std::size_t K, bool IsAlreadyHeap = false, typename T>
+    auto make_min_aligned_k_heap(std::vector<T>&& inputs = {}) {
+        return KHeap<K, T, IsAlreadyHeap, std::greater<T>, true>(std::move(inputs),
+                                                                 std::greater<T>{});
+    }
+
+    // create a cache-aligned Max K-Heap copying the input vector.
+    // Pick K such that K * sizeof(T) is a multiple of the cache line size.
+    template <std::size_t K, bool IsAlreadyHeap = false, typename T>
+    auto make_max_aligned_k_heap(const std::vector<T>& inputs) {
+        return KHeap<K, T, IsAlreadyHeap, std::less<T>, true>(inputs, std::less<T>{});
+    }
+
+    // create a cache-aligned Max K-Heap moving the input vector.
+    // Pick K such that K * sizeof(T) is a multiple of the cache line size.
+    template <std::size_t K, bool IsAlreadyHeap = false, typename T>
+    auto make_max_aligned_k_heap(std::vector<T>&& inputs = {}) {
+        return KHeap<K, T, IsAlreadyHeap, std::less<T>, true>(std::move(inputs), std::less<T>{});
+    }
+
+    // create a Min K-Heap moving the input vector and running the initial build with
+    // up to num_threads worker threads (0 picks the hardware concurrency)
+    template <std::size_t K, typename T>
+    auto make_min_k_heap_parallel(std::vector<T>&& inputs, const std::size_t num_threads = 0) {
+        KHeap<K, T, true> heap(std::move(inputs), std::greater<T>{});
+        heap.build_heap_parallel(num_threads);
+        return heap;
+    }
+
+    // create a Max K-Heap moving the input vector and running the initial build with
+    // up to num_threads worker threads (0 picks the hardware concurrency)
+    template <std::size_t K, typename T>
+    auto make_max_k_heap_parallel(std::vector<T>&& inputs, const std::size_t num_threads = 0) {
+        KHeap<K, T, true, std::less<T>> heap(std::move(inputs), std::less<T>{});
+        heap.build_heap_parallel(num_threads);
+        return heap;
     }
 
 }  // namespace heap
 
-#endif  // K_HEAP_H
\ No newline at end of file
+#endif  // K_HEAP_H
@@ -0,0 +1,291 @@
+#ifndef LAZY_PRIORITY_QUEUE_H
+#define LAZY_PRIORITY_QUEUE_H
+
+#include <algorithm>      // std::remove_if
+#include <cassert>        // std::assert
+#include <cstddef>        // std::size_t
+#include <cstdint>        // std::uint64_t
+#include <functional>     // std::hash
+#include <type_traits>    // std::conditional_t, std::is_base_of
+#include <unordered_map>  // std::unordered_map
+#include <utility>        // std::move, std::pair
+#include <vector>         // std::vector
+
+#include "BinaryHeap.h"
+#include "Heap.h"
+#include "KHeap.h"
+#include "PriorityQueue.h"
+
+namespace priority_queue {
+
+    namespace detail {
+
+        // heap entry of the lazy mode: a (key, element) version. The version stamp links
+        // the entry to the bookkeeping map; an entry whose stamp is no longer the
+        // element's current one is a tombstone.
+        template <typename Key, typename T>
+        struct lazy_entry_t {
+            Key key;
+            std::uint64_t version;
+            T element;
+        };
+
+        // order lazy entries by key only, Min Heap flavor
+        template <typename Key, typename T>
+        struct lazy_min_compare {
+            [[nodiscard]] bool operator()(const lazy_entry_t<Key, T>& a,
+                                          const lazy_entry_t<Key, T>& b) const {
+                return a.key > b.key;
+            }
+        };
+
+        // order lazy entries by key only, Max Heap flavor
+        template <typename Key, typename T>
+        struct lazy_max_compare {
+            [[nodiscard]] bool operator()(const lazy_entry_t<Key, T>& a,
+                                          const lazy_entry_t<Key, T>& b) const {
+                return a.key < b.key;
+            }
+        };
+
+    }  // namespace detail
+
+    /**
+     * Priority Queue with lazy deletion: update_key() and remove() never sift the
+     * existing entries. An update pushes a NEW (key, element) version and marks the old
+     * one dead by bumping the element's version stamp; dead entries are skipped when
+     * they surface at top()/pop() and the node vector is compacted with one
+     * build_heap() pass once tombstones exceed a configurable fraction.
+     *
+     * Compared with PriorityQueue, which pays an O(logN) sift plus index_map writes on
+     * every update, an update here is a plain O(logN) push with no position tracking at
+     * all — the better trade when elements are re-keyed several times between pops, at
+     * the cost of tombstone memory. top() purges dead entries and is therefore not
+     * const.
+     * This class shouldn't be invoked directly.
+     * Instead, the factories make_min_lazy_priority_queue etc. should be used.
+     *
+     * Heap: the heap engine ordering the lazy entries (BinaryHeap or KHeap of
+     *       detail::lazy_entry_t<Key, T>).
+     * Key: type of the keys used to order the elements.
+     * T: the type of the elements. Must be hashable.
+     * THash: hash functor type for the elements.
+     * HeapType: min_heap or max_heap flavor.
+     */
+    template <class Heap, typename Key, typename T, typename THash = std::hash<T>,
+              Type HeapType = Type::min_heap>
+    class LazyPriorityQueue
+        : private Heap::template rebind<
+              std::conditional_t<HeapType == Type::min_heap, detail::lazy_min_compare<Key, T>,
+                                 detail::lazy_max_compare<Key, T>>,
+              LazyPriorityQueue<Heap, Key, T, THash, HeapType>> {
+        using entry_type = detail::lazy_entry_t<Key, T>;
+        using compare_type =
+            std::conditional_t<HeapType == Type::min_heap, detail::lazy_min_compare<Key, T>,
+                               detail::lazy_max_compare<Key, T>>;
+
+        using super = typename Heap::template rebind<compare_type, LazyPriorityQueue>;
+
+        // the heap classes reach the protected members of this class through self()
+        friend super;
+        friend class heap::Heap<LazyPriorityQueue, entry_type, compare_type, false,
+                                typename Heap::allocator_type>;
+
+        static_assert(std::is_base_of<heap::Heap<LazyPriorityQueue, entry_type, compare_type,
+                                                 false, typename Heap::allocator_type>,
+                                      super>::value,
+                      "Heap must derive heap::Heap");
+
+        // current version stamp and key of each live element
+        struct live_t {
+            std::uint64_t version;
+            Key key;
+        };
+
+        // live[element] -> its current version stamp and key. An element absent here, or
+        // a heap entry with an older stamp, is dead.
+        std::unordered_map<T, live_t, THash> live;
+
+        // globally increasing stamp source
+        std::uint64_t next_version = 1;
+
+        // number of dead entries still sitting in the heap
+        std::size_t dead_count = 0;
+
+        // compact once dead entries exceed this fraction of the heap
+        double max_dead_ratio;
+
+        // return true iff the given heap entry is a tombstone
+        [[nodiscard]] bool is_dead(const entry_type& entry) const {
+            const auto search = live.find(entry.element);
+            return search == live.end() || search->second.version != entry.version;
+        }
+
+        // pop dead entries until the top is live (or the heap is empty)
+        void purge() {
+            while (!super::empty() && is_dead(super::top())) {
+                super::pop();
+                dead_count--;
+            }
+        }
+
+        // one O(n) compaction pass once the tombstone fraction is exceeded: dead
+        // entries are filtered out in place and the heap is rebuilt with build_heap()
+        void maybe_compact() {
+            if (dead_count == 0 ||
+                static_cast<double>(dead_count) <
+                    max_dead_ratio * static_cast<double>(this->nodes.size())) {
+                return;
+            }
+
+            const auto is_dead_entry = [this](const entry_type& entry) {
+                return is_dead(entry);
+            };
+
+            this->nodes.erase(
+                std::remove_if(this->nodes.begin(), this->nodes.end(), is_dead_entry),
+                this->nodes.end());
+            dead_count = 0;
+
+            this->build_heap();
+        }
+
+    public:
+        LazyPriorityQueue() = delete;
+
+        // max_dead_ratio: fraction of dead entries that triggers compaction
+        explicit LazyPriorityQueue(const double max_dead_ratio) :
+            super(std::vector<entry_type>{}, compare_type{}), max_dead_ratio(max_dead_ratio) {
+            assert(max_dead_ratio > 0.0);
+        }
+
+        ~LazyPriorityQueue() = default;
+
+        // return the number of LIVE elements in the queue.
+        // Time: O(1).
+        [[nodiscard]] std::size_t size() const noexcept {
+            return live.size();
+        }
+
+        // return true iff the queue holds no live element.
+        // Time: O(1).
+        [[nodiscard]] bool empty() const noexcept {
+            return live.empty();
+        }
+
+        // add a new element with the given key, or re-key it if already present: both
+        // cases push one new entry, and a re-key turns the old entry into a tombstone
+        // instead of sifting it.
+        // Time: O(logN) amortized.
+        void push(const Key& key, const T& element) {
+            const auto [search, inserted] = live.try_emplace(element, live_t{0, key});
+
+            if (!inserted) {
+                // the previous version becomes a tombstone
+                dead_count++;
+            }
+
+            search->second = live_t{next_version, key};
+            super::push(entry_type{key, next_version, element});
+            next_version++;
+
+            maybe_compact();
+        }
+
+        // update the key of the given element: an alias of push(), spelled out to keep
+        // call sites interchangeable with PriorityQueue
+        void update_key(const Key& key, const T& element) {
+            push(key, element);
+        }
+
+        // remove the given element (which must exist): its entry becomes a tombstone.
+        // Time: O(1) amortized, plus the deferred compaction share.
+        void remove(const T& element) {
+            const auto erased = live.erase(element);
+            assert(erased == 1);
+            (void)erased;
+
+            dead_count++;
+            maybe_compact();
+        }
+
+        // return the key of the given element (which must exist).
+        // Time: O(1) amortized.
+        [[nodiscard]] const Key& key_at(const T& element) const {
+            return live.at(element).key;
+        }
+
+        // return true iff the given element is live in the queue.
+        // Time: O(1) amortized.
+        [[nodiscard]] bool contains(const T& element) const {
+            return live.count(element) > 0;
+        }
+
+        // return the top element. Purges any dead entries sitting on top first, hence
+        // not const.
+        // Time: O(1) amortized.
+        [[nodiscard]] const T& top() {
+            purge();
+            assert(!super::empty());
+
+            return super::top().element;
+        }
+
+        // remove the top live element and return its (key, element) pair.
+        // Time: O(logN) amortized.
+        [[nodiscard]] std::pair<Key, T> pop_top() {
+            purge();
+            assert(!super::empty());
+
+            entry_type entry = super::pop_top();
+            live.erase(entry.element);
+
+            return {std::move(entry.key), std::move(entry.element)};
+        }
+
+        // remove the top live element.
+        // Time: O(logN) amortized.
+        void pop() {
+            purge();
+            assert(!super::empty());
+
+            live.erase(super::top().element);
+            super::pop();
+        }
+    };
+
+    // create a lazy-deletion Priority Queue based on a Min Heap
+    template <typename Key, typename Value, typename THash = std::hash<Value>>
+    auto make_min_lazy_priority_queue(const double max_dead_ratio = 0.5) {
+        using pq = LazyPriorityQueue<heap::BinaryHeap<detail::lazy_entry_t<Key, Value>>, Key,
+                                     Value, THash, Type::min_heap>;
+        return pq(max_dead_ratio);
+    }
+
+    // create a lazy-deletion Priority Queue based on a Max Heap
+    template <typename Key, typename Value, typename THash = std::hash<Value>>
+    auto make_max_lazy_priority_queue(const double max_dead_ratio = 0.5) {
+        using pq = LazyPriorityQueue<heap::BinaryHeap<detail::lazy_entry_t<Key, Value>>, Key,
+                                     Value, THash, Type::max_heap>;
+        return pq(max_dead_ratio);
+    }
+
+    // create a lazy-deletion Priority Queue based on a Min K-Heap
+    template <std::size_t K, typename Key, typename Value, typename THash = std::hash<Value>>
+    auto make_min_lazy_k_priority_queue(const double max_dead_ratio = 0.5) {
+        using pq = LazyPriorityQueue<heap::KHeap<K, detail::lazy_entry_t<Key, Value>>, Key,
+                                     Value, THash, Type::min_heap>;
+        return pq(max_dead_ratio);
+    }
+
+    // create a lazy-deletion Priority Queue based on a Max K-Heap
+    template <std::size_t K, typename Key, typename Value, typename THash = std::hash<Value>>
+    auto make_max_lazy_k_priority_queue(const double max_dead_ratio = 0.5) {
+        using pq = LazyPriorityQueue<heap::KHeap<K, detail::lazy_entry_t<Key, Value>>, Key,
+                                     Value, THash, Type::max_heap>;
+        return pq(max_dead_ratio);
+    }
+
+}  // namespace priority_queue
+
+#endif  // LAZY_PRIORITY_QUEUE_H
@@ -0,0 +1,107 @@
+#ifndef NUMA_ALLOCATOR_H
+#define NUMA_ALLOCATOR_H
+
+#include <cstddef>  // std::size_t
+#include <new>      // std::bad_alloc, ::operator new
+
+#if defined(__linux__)
+#include <sys/mman.h>     // ::mmap, ::munmap, ::madvise
+#include <sys/syscall.h>  // SYS_mbind
+#include <unistd.h>       // ::syscall
+#endif
+
+namespace heap {
+
+    /**
+     * Allocator backing giant heaps with hugepage-friendly, NUMA-bound memory. Every
+     * allocation is a private anonymous mmap marked MADV_HUGEPAGE, so the kernel backs
+     * the node vector with transparent hugepages and the hot top-of-heap levels stay
+     * TLB-resident; an optional NUMA node binds the pages to the consuming socket, so a
+     * draining thread pinned there never pays cross-socket traffic. Both are best-effort
+     * hints: the allocation still succeeds on kernels without THP or NUMA support, and
+     * on non-Linux platforms the allocator degrades to plain ::operator new.
+     *
+     * It plugs into the existing allocator-taking factories, e.g.:
+     *   auto heap = heap::make_min_heap(std::move(inputs),
+     *                                   heap::numa_hugepage_allocator<int>(0));
+     *
+     * T: the type of the allocated objects.
+     */
+    template <typename T>
+    class numa_hugepage_allocator {
+        // NUMA node the pages are bound to, or -1 for no binding
+        int numa_node;
+
+#if defined(__linux__)
+        // MPOL_BIND from <numaif.h>, spelled out so that libnuma headers aren't needed
+        static constexpr int mpol_bind = 2;
+#endif
+
+    public:
+        using value_type = T;
+
+        explicit numa_hugepage_allocator(const int numa_node = -1) noexcept :
+            numa_node(numa_node) {
+        }
+
+        template <typename U>
+        explicit numa_hugepage_allocator(const numa_hugepage_allocator<U>& other) noexcept :
+            numa_node(other.node()) {
+        }
+
+        // NUMA node this allocator binds to (-1 if unbound)
+        [[nodiscard]] int node() const noexcept {
+            return numa_node;
+        }
+
+        [[nodiscard]] T* allocate(const std::size_t n) {
+#if defined(__linux__)
+            const std::size_t bytes = n * sizeof(T);
+
+            void* const pages = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (pages == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+
+            // ask for transparent hugepages; ignored on kernels without THP
+            ::madvise(pages, bytes, MADV_HUGEPAGE);
+
+            if (numa_node >= 0) {
+                // first-touch would spread the pages over whichever socket faults them
+                // in; binding keeps the whole heap local to the consumer. Best effort:
+                // a failure (e.g. single-node machine) leaves the default policy.
+                const unsigned long nodemask = 1UL << numa_node;
+                ::syscall(SYS_mbind, pages, bytes, mpol_bind, &nodemask,
+                          sizeof(nodemask) * 8, 0UL);
+            }
+
+            return static_cast<T*>(pages);
+#else
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+#endif
+        }
+
+        void deallocate(T* const p, const std::size_t n) noexcept {
+#if defined(__linux__)
+            ::munmap(p, n * sizeof(T));
+#else
+            (void)n;
+            ::operator delete(p);
+#endif
+        }
+
+        [[nodiscard]] friend bool operator==(const numa_hugepage_allocator& a,
+                                             const numa_hugepage_allocator& b) noexcept {
+            return a.numa_node == b.numa_node;
+        }
+
+        [[nodiscard]] friend bool operator!=(const numa_hugepage_allocator& a,
+                                             const numa_hugepage_allocator& b) noexcept {
+            return !(a == b);
+        }
+    };
+
+}  // namespace heap
+
+#endif  // NUMA_ALLOCATOR_H
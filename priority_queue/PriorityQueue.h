@@ -3,13 +3,21 @@
 
 #include <algorithm>      // std::swap, std::find
 #include <cassert>        // std::assert
-#include <functional>     // std::function
-#include <type_traits>    // std::enable_if
+#include <cstddef>        // std::size_t
+#include <cstdint>        // std::uint64_t
+#include <functional>     // std::hash
+#include <istream>        // std::istream
+#include <memory>         // std::allocator_traits
+#include <ostream>        // std::ostream
+#include <type_traits>    // std::conditional_t, std::is_base_of
 #include <unordered_map>  // std::unordered_map
+#include <utility>        // std::move, std::pair
+#include <vector>         // std::vector
 
 #include "BinaryHeap.h"
 #include "Heap.h"
 #include "KHeap.h"
+#include "SmallBuffer.h"
 
 namespace priority_queue {
 
@@ -17,6 +25,121 @@ namespace priority_queue {
     // whether PriorityQueue is using a Min Heap or a Max Heap implementation.
     enum class Type { min_heap, max_heap };
 
+    namespace detail {
+
+        // stateful comparison functor that orders elements by their key, Min Heap flavor.
+        // It is a concrete type (no std::function) invoked with const references, so the
+        // heaps can inline the key lookup on every sift step.
+        template <typename KeyMap>
+        class min_heap_compare {
+            const KeyMap* key_map = nullptr;
+
+        public:
+            min_heap_compare() = default;
+
+            explicit min_heap_compare(const KeyMap& key_map) noexcept : key_map(&key_map) {
+            }
+
+            template <typename U>
+            [[nodiscard]] bool operator()(const U& a, const U& b) const {
+                return key_map->at(a) > key_map->at(b);
+            }
+        };
+
+        // stateful comparison functor that orders elements by their key, Max Heap flavor.
+        template <typename KeyMap>
+        class max_heap_compare {
+            const KeyMap* key_map = nullptr;
+
+        public:
+            max_heap_compare() = default;
+
+            explicit max_heap_compare(const KeyMap& key_map) noexcept : key_map(&key_map) {
+            }
+
+            template <typename U>
+            [[nodiscard]] bool operator()(const U& a, const U& b) const {
+                return key_map->at(a) < key_map->at(b);
+            }
+        };
+
+        // composite key used by the stable mode: among equal keys, the node enqueued
+        // first (lower seq) wins. Note that BOTH operators break ties in the same
+        // direction, so FIFO holds for the min and the max flavor alike; they are
+        // deliberately not a consistent ordering outside the heap comparators.
+        template <typename Key>
+        struct stable_key_t {
+            Key key;
+            std::uint64_t seq;
+
+            [[nodiscard]] friend bool operator>(const stable_key_t& a, const stable_key_t& b) {
+                return a.key != b.key ? a.key > b.key : a.seq > b.seq;
+            }
+
+            [[nodiscard]] friend bool operator<(const stable_key_t& a, const stable_key_t& b) {
+                return a.key != b.key ? a.key < b.key : a.seq > b.seq;
+            }
+        };
+
+        // snapshot framing: magic + element count, then the keys and the elements as raw
+        // bytes in heap order. 8-byte header fields keep both payload sections naturally
+        // aligned, so a loader may also mmap the file and cast the sections directly.
+        inline constexpr std::uint64_t snapshot_magic = 0x4853515055454851ULL;
+
+        // read a snapshot back into (keys, elements) vectors, still in heap order
+        template <typename Key, typename T>
+        [[nodiscard]] std::pair<std::vector<Key>, std::vector<T>> read_snapshot(
+            std::istream& stream) {
+            static_assert(std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<T>,
+                          "snapshots require trivially copyable keys and elements");
+
+            std::uint64_t magic = 0;
+            std::uint64_t count = 0;
+            stream.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+            stream.read(reinterpret_cast<char*>(&count), sizeof(count));
+            assert(magic == snapshot_magic);
+
+            std::vector<Key> keys(count);
+            std::vector<T> elements(count);
+            stream.read(reinterpret_cast<char*>(keys.data()),
+                        static_cast<std::streamsize>(count * sizeof(Key)));
+            stream.read(reinterpret_cast<char*>(elements.data()),
+                        static_cast<std::streamsize>(count * sizeof(T)));
+
+            return {std::move(keys), std::move(elements)};
+        }
+
+        // hash-map types layered on top of a heap engine, with the engine's allocator
+        // rebound to the map's value type: one arena can then back the node vector,
+        // key_map and index_map of a whole queue
+        template <typename Heap, typename Key, typename T, typename THash>
+        using key_map_t = std::unordered_map<
+            T, Key, THash, std::equal_to<T>,
+            typename std::allocator_traits<typename Heap::allocator_type>::
+                template rebind_alloc<std::pair<const T, Key>>>;
+
+        template <typename Heap, typename T, typename THash>
+        using index_map_t = std::unordered_map<
+            T, std::size_t, THash, std::equal_to<T>,
+            typename std::allocator_traits<typename Heap::allocator_type>::
+                template rebind_alloc<std::pair<const T, std::size_t>>>;
+
+        // map selection for the small-buffer mode: a positive InlineCapacity swaps the
+        // unordered maps for flat linear-scan maps (see SmallBuffer.h) that stay inline,
+        // so tiny queues do zero map allocations
+        template <typename Heap, typename Key, typename T, typename THash,
+                  std::size_t InlineCapacity>
+        using select_key_map_t =
+            std::conditional_t<InlineCapacity == 0, key_map_t<Heap, Key, T, THash>,
+                               flat_map<T, Key, InlineCapacity>>;
+
+        template <typename Heap, typename T, typename THash, std::size_t InlineCapacity>
+        using select_index_map_t =
+            std::conditional_t<InlineCapacity == 0, index_map_t<Heap, T, THash>,
+                               flat_map<T, std::size_t, InlineCapacity>>;
+
+    }  // namespace detail
+
     /**
      * Generic Priority Queue based on a Heap. Whether it is based on a MinHeap or a MaxHeap
      * depends on CompareFactory object used for initialization.
@@ -25,6 +148,8 @@ namespace priority_queue {
      * make_min_k_priority_queue, make_max_k_priority_queue should be used.
      *
      * Heap: type of the parent class of PriorityQueue. It must derive heap::Heap.
+     *       PriorityQueue rebinds the CRTP chain of the given heap to itself, so that
+     *       the heap base dispatches swap_nodes() & co. to this class statically.
      * Key: type of the keys used to order the Heap.
      * T: type of the elements stored in the Heap underlying the Priority Queue.
      * IsAlreadyHeap: constexpr flag. If true, build_heap() won't be called after the class is
@@ -32,16 +157,56 @@ namespace priority_queue {
      *                according to its keys.
      * T_Hash: functor used to hash values of type T. Necessary only if T is a non-trivial type.
      * HeapType: enum utility used to understand whether Heap is a Min Heap or a Max Heap.
+     * Stable: if true, elements with equal keys pop in FIFO enqueue order. Each stored
+     *         key carries a 64-bit sequence stamp and the comparators break ties on it
+     *         with a single extra branch, instead of callers packing sequence numbers
+     *         into the key themselves. A re-keyed element is re-stamped, i.e. it goes to
+     *         the back of its new priority class.
+     * InlineCapacity: small-buffer threshold for the bookkeeping maps. When positive,
+     *                 key_map and index_map become flat linear-scan maps holding up to
+     *                 InlineCapacity entries inline; combined with an SBO heap engine,
+     *                 tiny queues do zero allocations.
      */
     template <class Heap, typename Key, typename T, bool IsAlreadyHeap = false,
               typename THash = std::hash<T>, Type HeapType = Type::min_heap,
-              typename = std::enable_if<std::is_base_of<heap::Heap<T, IsAlreadyHeap>, Heap>::value>>
-    class PriorityQueue : Heap {
-        using super = Heap;
-        using key_map_type = std::unordered_map<T, Key, THash>;
-        using index_map_type = std::unordered_map<T, std::size_t, THash>;
-        using compare_t = std::function<bool(T, T)>;
-        using compare_factory_t = std::function<compare_t(key_map_type&)>;
+              bool Stable = false, std::size_t InlineCapacity = 0>
+    class PriorityQueue
+        : private Heap::template rebind<
+              std::conditional_t<
+                  HeapType == Type::min_heap,
+                  detail::min_heap_compare<detail::select_key_map_t<
+                      Heap, std::conditional_t<Stable, detail::stable_key_t<Key>, Key>, T,
+                      THash, InlineCapacity>>,
+                  detail::max_heap_compare<detail::select_key_map_t<
+                      Heap, std::conditional_t<Stable, detail::stable_key_t<Key>, Key>, T,
+                      THash, InlineCapacity>>>,
+              PriorityQueue<Heap, Key, T, IsAlreadyHeap, THash, HeapType, Stable,
+                            InlineCapacity>> {
+        // key as stored in key_map: the plain Key, or (key, seq) in stable mode
+        using stored_key_type = std::conditional_t<Stable, detail::stable_key_t<Key>, Key>;
+
+        using key_map_type =
+            detail::select_key_map_t<Heap, stored_key_type, T, THash, InlineCapacity>;
+        using index_map_type = detail::select_index_map_t<Heap, T, THash, InlineCapacity>;
+
+        // concrete comparator type that orders the heap by key, selected at compile time
+        // according to the heap flavor
+        using compare_type =
+            std::conditional_t<HeapType == Type::min_heap, detail::min_heap_compare<key_map_type>,
+                               detail::max_heap_compare<key_map_type>>;
+
+        using super = typename Heap::template rebind<compare_type, PriorityQueue>;
+
+        // the heap classes reach the protected members of this class through self()
+        friend super;
+        friend class heap::Heap<PriorityQueue, T, compare_type, IsAlreadyHeap,
+                                typename Heap::allocator_type, Heap::inline_capacity>;
+
+        static_assert(std::is_base_of<heap::Heap<PriorityQueue, T, compare_type, IsAlreadyHeap,
+                                                 typename Heap::allocator_type,
+                                                 Heap::inline_capacity>,
+                                      super>::value,
+                      "Heap must derive heap::Heap");
 
         // keep track of the value of the keys of each node.
         // key_map[element] -> key assigned to element
@@ -51,18 +216,40 @@ namespace priority_queue {
         // index_map[element] -> index in this->nodes of element
         index_map_type index_map;
 
+        // construct an empty bookkeeping map pre-sized for the given element count. The
+        // unordered maps take the bucket count and the (rebound) allocator; the flat
+        // maps of the small-buffer mode just reserve and ignore the allocator
+        template <typename Map>
+        [[nodiscard]] static Map make_map(const std::size_t capacity,
+                                          const typename Map::allocator_type& allocator) {
+            if constexpr (InlineCapacity == 0) {
+                return Map(capacity, THash(), std::equal_to<T>(), allocator);
+            } else {
+                (void)allocator;
+                Map map;
+                map.reserve(capacity);
+                return map;
+            }
+        }
+
         // initialize key_map
-        template <typename UKey, typename U, typename UHash>
-        [[nodiscard]] static auto build_key_map(const std::vector<UKey>& keys,
-                                                const std::vector<U>& node_list) {
+        template <typename NodeList>
+        [[nodiscard]] static key_map_type build_key_map(
+            const std::vector<Key>& keys, const NodeList& node_list,
+            const typename key_map_type::allocator_type& allocator = {}) {
             assert(keys.size() == node_list.size());
 
-            std::unordered_map<U, UKey, UHash> local_key_map(node_list.size());
+            key_map_type local_key_map = make_map<key_map_type>(node_list.size(), allocator);
 
-            // traverses keys and node_list at the same time
+            // traverses keys and node_list at the same time. In stable mode the input
+            // order provides the initial sequence stamps.
             std::size_t index = 0;
             for (const auto& node : node_list) {
-                local_key_map[node] = keys[index];
+                if constexpr (Stable) {
+                    local_key_map[node] = stored_key_type{keys[index], index};
+                } else {
+                    local_key_map[node] = keys[index];
+                }
                 index++;
             }
 
@@ -70,9 +257,12 @@ namespace priority_queue {
         }
 
         // initialize index_map
-        template <typename U, typename UHash>
-        [[nodiscard]] static auto build_index_map(const std::vector<U>& node_list) {
-            std::unordered_map<U, std::size_t, UHash> local_index_map(node_list.size());
+        template <typename NodeList>
+        [[nodiscard]] static index_map_type build_index_map(
+            const NodeList& node_list,
+            const typename index_map_type::allocator_type& allocator = {}) {
+            index_map_type local_index_map =
+                make_map<index_map_type>(node_list.size(), allocator);
 
             std::size_t index = 0;
             for (const auto& node : node_list) {
@@ -83,20 +273,55 @@ namespace priority_queue {
             return local_index_map;
         }
 
+        // monotonically increasing enqueue counter for the stable mode
+        std::uint64_t next_seq = 0;
+
+        // wrap a key for storage in key_map, stamping the next sequence number in
+        // stable mode. A re-keyed element gets a fresh stamp, i.e. it goes to the back
+        // of its new priority class.
+        [[nodiscard]] stored_key_type make_stored_key(const Key& key) {
+            if constexpr (Stable) {
+                return stored_key_type{key, next_seq++};
+            } else {
+                return key;
+            }
+        }
+
+        // strip the stability stamp off a stored key
+        [[nodiscard]] static const Key& plain_key(const stored_key_type& stored) noexcept {
+            if constexpr (Stable) {
+                return stored.key;
+            } else {
+                return stored;
+            }
+        }
+
+        [[nodiscard]] static Key take_key(stored_key_type&& stored) {
+            if constexpr (Stable) {
+                return std::move(stored.key);
+            } else {
+                return std::move(stored);
+            }
+        }
+
         // initialize class
-        void init(compare_factory_t&& comp_factory) {
+        void init() {
             // set comparator in base class after initialization of key_map and index_map.
-            // We can't set it directly in super(inputs, comp_factory(key_map) because we need
+            // We can't set it directly in super(inputs, compare_type(key_map)) because we need
             // to initialize key_map first, and member objects can only be initialized after
             // the parent class is completely initialized.
-            this->comp = comp_factory(key_map);
+            this->comp = compare_type(key_map);
+
+            if constexpr (Stable) {
+                next_seq = size();
+            }
             super::init();
         }
 
     protected:
         void swap_nodes(std::size_t i, std::size_t j) noexcept {
-            auto node_i = this->nodes.at(i);
-            auto node_j = this->nodes.at(j);
+            auto node_i = this->node_at(i);
+            auto node_j = this->node_at(j);
 
             // swap the indexes
             std::swap(index_map.at(node_i), index_map.at(node_j));
@@ -105,23 +330,132 @@ namespace priority_queue {
             super::swap_nodes(i, j);
         }
 
+        // hole-based sift support: a shifted node needs a single index_map update
+        void shift_node(const std::size_t dst, const std::size_t src) noexcept {
+            super::shift_node(dst, src);
+            index_map.at(this->node_at(dst)) = dst;
+        }
+
+        // hole-based sift support: the saved element is indexed once, at its final position
+        void place_node(const std::size_t index, T&& value) {
+            index_map.at(value) = index;
+            super::place_node(index, std::move(value));
+        }
+
+        // heap slots of the best min(k, size()) entries, in pop order. A small side-heap
+        // of candidate slots is grown from the root: the best candidate is taken and its
+        // children become candidates, so the walk reads O(k) nodes and never mutates the
+        // heap — no sift, no map traffic. The selected set is connected and up-closed by
+        // construction (a child is only reachable after its parent was taken), which
+        // pop_k() relies on for the hole refill.
+        [[nodiscard]] std::vector<std::size_t> collect_top_indices(std::size_t k) const {
+            const std::size_t offset = super::layout_offset();
+            k = std::min(k, this->size());
+
+            std::vector<std::size_t> taken;
+            taken.reserve(k);
+
+            if (k == 0) {
+                return taken;
+            }
+
+            // comp orders "a after b", so the std heap algorithms keep the best slot
+            // at the front
+            const auto after = [this](const std::size_t a, const std::size_t b) {
+                return this->comp(this->node_at(a), this->node_at(b));
+            };
+
+            std::vector<std::size_t> candidates{offset};
+
+            while (taken.size() < k) {
+                std::pop_heap(candidates.begin(), candidates.end(), after);
+                const std::size_t slot = candidates.back();
+                candidates.pop_back();
+                taken.emplace_back(slot);
+
+                for (std::size_t j = 0; j < super::arity; ++j) {
+                    const std::size_t child = (slot - offset) * super::arity + 1 + j + offset;
+                    if (child < this->nodes.size()) {
+                        candidates.emplace_back(child);
+                        std::push_heap(candidates.begin(), candidates.end(), after);
+                    }
+                }
+            }
+
+            return taken;
+        }
+
+        // bubble the node at the given index up, comparing its already-resolved key against
+        // the parent keys. The generic heapify_up would re-resolve the moving element's key
+        // through key_map at every level; here the hot path of push/decrease-key pays one
+        // hash lookup per level (the parent's) instead of two.
+        void sift_up_with_key(const std::size_t index_to_fix, const stored_key_type& key) {
+            std::size_t i = index_to_fix;
+            std::size_t depth = 0;
+            std::size_t comparisons = 0;
+            T moving = std::move(this->node_at(i));
+
+            while (i > 0) {
+                const auto p = this->parent(i);
+                const stored_key_type& parent_key = key_map.at(this->node_at(p));
+                comparisons++;
+
+                if constexpr (HeapType == Type::min_heap) {
+                    if (!(parent_key > key)) {
+                        break;
+                    }
+                } else {
+                    if (!(parent_key < key)) {
+                        break;
+                    }
+                }
+
+                this->shift_node(i, p);
+                i = p;
+                depth++;
+            }
+
+            this->place_node(i, std::move(moving));
+            this->stat_count_sift(depth, comparisons);
+        }
+
     public:
         PriorityQueue() = delete;
 
-        explicit PriorityQueue(const std::vector<Key>& keys, const std::vector<T>& inputs,
-                               compare_factory_t&& comp_factory) :
+        explicit PriorityQueue(const std::vector<Key>& keys, const std::vector<T>& inputs) :
             super(inputs),
-            key_map(build_key_map<Key, T, THash>(keys, this->nodes)),
-            index_map(build_index_map<T, THash>(this->nodes)) {
-            init(std::move(comp_factory));
+            key_map(build_key_map(keys, this->nodes)),
+            index_map(build_index_map(this->nodes)) {
+            init();
         }
 
-        explicit PriorityQueue(std::vector<Key>&& keys, std::vector<T>&& inputs,
-                               compare_factory_t&& comp_factory) :
+        explicit PriorityQueue(std::vector<Key>&& keys, std::vector<T>&& inputs) :
             super(std::move(inputs)),
-            key_map(build_key_map<Key, T, THash>(std::move(keys), this->nodes)),
-            index_map(build_index_map<T, THash>(this->nodes)) {
-            init(std::move(comp_factory));
+            key_map(build_key_map(keys, this->nodes)),
+            index_map(build_index_map(this->nodes)) {
+            init();
+        }
+
+        // allocator-aware constructors: the node vector, key_map and index_map all share
+        // the given allocator (rebound to each value type), so one arena backs the queue
+        explicit PriorityQueue(const std::vector<Key>& keys, const std::vector<T>& inputs,
+                               const typename super::allocator_type& allocator) :
+            super(inputs, allocator),
+            key_map(build_key_map(keys, this->nodes,
+                                  typename key_map_type::allocator_type(allocator))),
+            index_map(build_index_map(this->nodes,
+                                      typename index_map_type::allocator_type(allocator))) {
+            init();
+        }
+
+        explicit PriorityQueue(std::vector<Key>&& keys, std::vector<T>&& inputs,
+                               const typename super::allocator_type& allocator) :
+            super(std::move(inputs), allocator),
+            key_map(build_key_map(keys, this->nodes,
+                                  typename key_map_type::allocator_type(allocator))),
+            index_map(build_index_map(this->nodes,
+                                      typename index_map_type::allocator_type(allocator))) {
+            init();
         }
 
         ~PriorityQueue() = default;
@@ -140,31 +474,132 @@ namespace priority_queue {
             return super::empty();
         }
 
+        // pre-size the heap vector and both hash maps for the given number of elements
+        // in one call, so that loading a known workload doesn't pay repeated vector
+        // reallocations and hash rehashes
+        void reserve(const std::size_t capacity) {
+            super::reserve(capacity);
+            key_map.reserve(capacity);
+            index_map.reserve(capacity);
+        }
+
+        // select the growth policy applied to the heap vector on push
+        void set_growth_policy(const heap::growth_policy policy) noexcept {
+            super::set_growth_policy(policy);
+        }
+
+        // return the operation counters collected under HEAP_STATS (zeroed otherwise)
+        [[nodiscard]] const heap::stats_t& stats() const noexcept {
+            return super::stats();
+        }
+
         // add a new element to the heap and associates the given key to it.
         // Time: O(logN) amortized if using BinaryHeap, O(k*log_k(N)) amortized instead.
         // Space: O(1) amortized.
         void push(const Key& key, const T& element) {
             const std::size_t index_to_fix = this->size();
             index_map[element] = index_to_fix;
-            key_map[element] = key;
+            const stored_key_type& stored_key = key_map[element] = make_stored_key(key);
+
+            // insert new node at the end of the vector, then bubble it up with its key
+            // resolved once instead of once per level
+            this->grow_for_push();
+            this->stat_count_push(this->nodes.size() == this->nodes.capacity());
+            this->nodes.emplace_back(element);
+            sift_up_with_key(index_to_fix, stored_key);
+        }
+
+        // add a batch of key/element pairs to the heap in one go. key_map and index_map are
+        // bulk-reserved, the elements are appended with a single reservation, and the heap
+        // property is recovered once at the end: one heapify_up per element for small
+        // batches, a single build_heap() when the batch rivals the heap size.
+        // Time: O(min(b*logN, N + b)) amortized, for a batch of b elements.
+        // Space: O(b) amortized.
+        void push_bulk(std::vector<Key>&& keys, std::vector<T>&& elements) {
+            assert(keys.size() == elements.size());
+
+            const std::size_t old_size = this->size();
+            const std::size_t appended = elements.size();
 
-            super::push(element);
+            key_map.reserve(old_size + appended);
+            index_map.reserve(old_size + appended);
+            this->nodes.reserve(old_size + appended);
+
+            std::size_t index = old_size;
+            for (auto& element : elements) {
+                index_map[element] = index;
+                key_map[element] = make_stored_key(keys[index - old_size]);
+                this->nodes.emplace_back(std::move(element));
+                index++;
+            }
+
+            this->sift_appended(old_size);
         }
 
-        // update the key of an element in the priority queue.
-        // The element must exist in the priority queue.
+        // update the key of an element in the priority queue, in either direction.
+        // The element must exist in the priority queue. The old and the new key are
+        // compared once to pick the sift direction, so increases on a Min Heap (and
+        // decreases on a Max Heap) are handled too instead of silently corrupting the
+        // heap order.
         // Time: O(logN) amortized if using BinaryHeap, O(k*log_k(N)) amortized instead.
         // Space: O(1) amortized.
         void update_key(const Key& key, const T& element) {
+            this->stat_count_update();
+
             const std::size_t index_to_fix = index_map.at(element);
-            key_map.at(element) = key;
 
-            // recover the heap property
+            auto& stored_slot = key_map.at(element);
+            const stored_key_type old_key = stored_slot;
+            const stored_key_type& stored_key = stored_slot = make_stored_key(key);
+
+            // recover the heap property in whichever direction the key moved. The new
+            // key is resolved once instead of once per level.
             if constexpr (HeapType == Type::min_heap) {
-                // we're using a MinHeap, thus we are decreasing the key
-                this->heapify_up(index_to_fix);
+                if (old_key > stored_key) {
+                    sift_up_with_key(index_to_fix, stored_key);
+                } else {
+                    this->heapify_down(index_to_fix);
+                }
+            } else {
+                if (old_key < stored_key) {
+                    sift_up_with_key(index_to_fix, stored_key);
+                } else {
+                    this->heapify_down(index_to_fix);
+                }
+            }
+        }
+
+        // remove the given element (which must exist) from any position of the queue:
+        // the last node is swapped into its slot, the bookkeeping entries are erased,
+        // and the displaced node is sifted in whichever direction it needs — so a
+        // cancelled entry costs O(logN) now instead of a dead slot and a wasted pop()
+        // later.
+        // Time: O(logN) amortized if using BinaryHeap, O(k*log_k(N)) amortized instead.
+        // Space: O(1).
+        void remove(const T& element) {
+            const std::size_t index_to_fix = index_map.at(element);
+            const std::size_t last = this->nodes.size() - 1;
+
+            index_map.erase(element);
+            key_map.erase(element);
+
+            if (index_to_fix == last) {
+                this->nodes.pop_back();
+                return;
+            }
+
+            // move the last node into the freed slot
+            this->node_at(index_to_fix) = std::move(this->nodes.back());
+            this->nodes.pop_back();
+
+            const T& moved = this->node_at(index_to_fix);
+            index_map.at(moved) = index_to_fix;
+
+            // the displaced node may beat its new parent or lose to its new children
+            if (index_to_fix > 0 &&
+                this->comp(this->node_at(this->parent(index_to_fix)), moved)) {
+                sift_up_with_key(index_to_fix, key_map.at(moved));
             } else {
-                // we're using a MaxHeap, thus we are increasing the key
                 this->heapify_down(index_to_fix);
             }
         }
@@ -173,7 +608,7 @@ namespace priority_queue {
         // Time: O(1) amortized.
         // Space: O(1).
         [[nodiscard]] const Key& key_at(const T& element) const {
-            return key_map.at(element);
+            return plain_key(key_map.at(element));
         }
 
         // return true iff the given element is in the priority queue.
@@ -200,6 +635,296 @@ namespace priority_queue {
             return {top_key, top_value};
         }
 
+        // remove the top key-value pair and return it. The element and its key are moved
+        // out instead of being discarded, so draining consumers don't pay extra copies.
+        // Time: O(logN) amortized if using BinaryHeap, O(k*log_k(N)) amortized instead.
+        // Space: O(1).
+        [[nodiscard]] std::pair<Key, T> pop_top() {
+            assert(this->size() > 0);
+
+            // move the root out before overwriting it
+            T top_value = std::move(this->node_at(0));
+            Key top_key = take_key(std::move(key_map.at(top_value)));
+
+            index_map.erase(top_value);
+            key_map.erase(top_value);
+
+            // replace root of the heap with the last element of the vector
+            this->node_at(0) = std::move(this->nodes.back());
+
+            // remove the last element of the vector
+            this->nodes.pop_back();
+
+            // no need to recover the heap property if the heap is empty
+            if (this->size() > 0) {
+                index_map.at(this->nodes.front()) = 0;
+
+                // the root violates the heap property. Let's fix that
+                this->heapify_down(0);
+            }
+
+            return {std::move(top_key), std::move(top_value)};
+        }
+
+        // replace the top key-value pair (which must exist) with the given one and
+        // return the old pair. The new element is written straight over the root and
+        // sifted down once, and only the two affected entries touch key_map/index_map:
+        // streaming pop()+push() consumers (e.g. k-way merges) pay a single sift and
+        // four map operations instead of two sifts and six.
+        // Time: O(logN) amortized if using BinaryHeap, O(k*log_k(N)) amortized instead.
+        // Space: O(1).
+        [[nodiscard]] std::pair<Key, T> replace_top(const Key& key, T&& element) {
+            assert(this->size() > 0);
+
+            this->stat_count_update();
+
+            // move the root out before overwriting it
+            T top_value = std::move(this->node_at(0));
+            Key top_key = take_key(std::move(key_map.at(top_value)));
+
+            index_map.erase(top_value);
+            key_map.erase(top_value);
+
+            this->node_at(0) = std::move(element);
+            const T& root = this->node_at(0);
+            index_map[root] = 0;
+            key_map[root] = make_stored_key(key);
+
+            // the root violates the heap property. Let's fix that
+            this->heapify_down(0);
+
+            return {std::move(top_key), std::move(top_value)};
+        }
+
+        // replace the top key-value pair with a copy of the given element
+        [[nodiscard]] std::pair<Key, T> replace_top(const Key& key, const T& element) {
+            return replace_top(key, T(element));
+        }
+
+        // return the best min(k, size()) key-value pairs in pop order WITHOUT removing
+        // them. The side-heap walk of collect_top_indices() reads O(k) nodes and leaves
+        // the heap untouched: no sift and no map operation at all, against the k full
+        // heapify_down walks of k separate pops.
+        // Time: O(k*log(k)). Space: O(k).
+        [[nodiscard]] std::vector<std::pair<Key, T>> top_k(const std::size_t k) const {
+            const std::vector<std::size_t> taken = collect_top_indices(k);
+
+            std::vector<std::pair<Key, T>> result;
+            result.reserve(taken.size());
+
+            for (const std::size_t slot : taken) {
+                const T& element = this->node_at(slot);
+                result.emplace_back(plain_key(key_map.at(element)), element);
+            }
+
+            return result;
+        }
+
+        // remove the best min(k, size()) key-value pairs and return them in pop order.
+        // The winners are located with one side-heap walk, their map entries are erased
+        // in a single pass, and the holes are refilled back-to-front from the tail of
+        // the node vector — deepest hole first, so every refill sifts down through an
+        // already-repaired subtree. Batched dispatchers pay k short sifts over a heap
+        // that is read once, instead of k independent pops re-touching the same
+        // top-of-heap cache lines.
+        // Time: O(k*log(N)) amortized, with a much smaller constant than k pops.
+        // Space: O(k).
+        [[nodiscard]] std::vector<std::pair<Key, T>> pop_k(const std::size_t k) {
+            std::vector<std::size_t> taken = collect_top_indices(k);
+
+            std::vector<std::pair<Key, T>> result;
+            result.reserve(taken.size());
+
+            // one pass of map erasures, in pop order so the result comes out sorted
+            for (const std::size_t slot : taken) {
+                this->stat_count_pop();
+
+                T& element = this->node_at(slot);
+                Key key = take_key(std::move(key_map.at(element)));
+
+                index_map.erase(element);
+                key_map.erase(element);
+                result.emplace_back(std::move(key), std::move(element));
+            }
+
+            // refill the holes from the back of the node vector, deepest hole first:
+            // the selected set is up-closed, so every hole's descendants are already
+            // valid survivors when its refill sifts down
+            std::sort(taken.begin(), taken.end(), std::greater<std::size_t>{});
+
+            for (const std::size_t slot : taken) {
+                const std::size_t last = this->nodes.size() - 1;
+
+                if (slot != last) {
+                    this->node_at(slot) = std::move(this->nodes.back());
+                }
+                this->nodes.pop_back();
+
+                if (slot < this->nodes.size()) {
+                    index_map.at(this->node_at(slot)) = slot;
+                    this->heapify_down(slot);
+                }
+            }
+
+            return result;
+        }
+
+        // absorb every (key, element) pair of other into this queue, leaving other
+        // empty. The node vectors are concatenated and key_map/index_map are merged with
+        // pre-reserved capacity (key_map via unordered_map::merge, which splices nodes
+        // without rehashing the values), followed by a single sift_appended() pass — one
+        // O(n) build_heap() when other is large — instead of paying a pop()/push() round
+        // trip with its 4 hash operations per melded element.
+        // The element sets of the two queues must be disjoint.
+        // Time: O(N + M) for large M, O(M*logN) for small M.
+        void meld(PriorityQueue&& other) {
+            const std::size_t old_size = this->nodes.size();
+
+            this->nodes.reserve(old_size + other.size());
+            key_map.reserve(size() + other.size());
+            index_map.reserve(size() + other.size());
+
+            for (auto& element : other.nodes) {
+                index_map[element] = this->nodes.size();
+                this->nodes.emplace_back(std::move(element));
+            }
+
+            key_map.merge(std::move(other.key_map));
+
+            // leftovers mean the element sets weren't disjoint
+            assert(other.key_map.empty());
+
+            if constexpr (Stable) {
+                // melded elements keep their stamps: FIFO order is preserved within each
+                // source queue, unspecified across the two
+                next_seq = std::max(next_seq, other.next_seq);
+            }
+
+            other.nodes.clear();
+            other.key_map.clear();
+            other.index_map.clear();
+
+            super::sift_appended(old_size);
+        }
+
+        // single-pass input iterator that consumes the queue as it advances: every
+        // dereference yields the next (key, element) pair in pop order. Obtained via
+        // drain(); two drain iterators over the same queue share the same elements.
+        class drain_iterator {
+            PriorityQueue* queue = nullptr;
+            std::pair<Key, T> current;
+
+            friend class PriorityQueue;
+
+            explicit drain_iterator(PriorityQueue& queue_to_drain) {
+                if (!queue_to_drain.empty()) {
+                    queue = &queue_to_drain;
+                    current = queue->pop_top();
+                }
+            }
+
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::pair<Key, T>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const value_type*;
+            using reference = const value_type&;
+
+            // the default-constructed iterator is the past-the-end sentinel
+            drain_iterator() = default;
+
+            [[nodiscard]] reference operator*() const noexcept {
+                return current;
+            }
+
+            [[nodiscard]] pointer operator->() const noexcept {
+                return &current;
+            }
+
+            drain_iterator& operator++() {
+                if (queue->empty()) {
+                    queue = nullptr;
+                } else {
+                    current = queue->pop_top();
+                }
+
+                return *this;
+            }
+
+            drain_iterator operator++(int) {
+                drain_iterator previous = *this;
+                ++(*this);
+                return previous;
+            }
+
+            [[nodiscard]] bool operator==(const drain_iterator& other) const noexcept {
+                return queue == other.queue;
+            }
+
+            [[nodiscard]] bool operator!=(const drain_iterator& other) const noexcept {
+                return !(*this == other);
+            }
+        };
+
+        // lightweight view returned by drain(), so the queue can be emptied with a
+        // range-based for loop
+        class drain_range {
+            PriorityQueue* queue;
+
+            friend class PriorityQueue;
+
+            explicit drain_range(PriorityQueue& queue_to_drain) noexcept :
+                queue(&queue_to_drain) {
+            }
+
+        public:
+            [[nodiscard]] drain_iterator begin() const {
+                return drain_iterator(*queue);
+            }
+
+            [[nodiscard]] drain_iterator end() const noexcept {
+                return drain_iterator();
+            }
+        };
+
+        // return a single-pass range over the (key, element) pairs in pop order.
+        // Iterating it consumes the queue: after the loop the queue is empty. Compared
+        // with a top()/pop() loop from application code, each element pays a single
+        // pop_top() instead of separate top_key_value()/pop() round trips.
+        // Time: O(NlogN) for a full drain.
+        [[nodiscard]] drain_range drain() noexcept {
+            return drain_range(*this);
+        }
+
+        // write a binary snapshot of the queue: magic + count header, then the keys and
+        // the elements as raw bytes in heap order. Loading it through the load_*
+        // factories rebuilds the queue via the IsAlreadyHeap path — one linear pass over
+        // pre-sized maps and no build_heap()/heapify_up at all — instead of replaying
+        // every push. Requires trivially copyable Key and T; in stable mode the FIFO
+        // stamps are not persisted and the load re-stamps elements in heap order.
+        void serialize(std::ostream& stream) const {
+            static_assert(std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<T>,
+                          "snapshots require trivially copyable keys and elements");
+
+            const std::uint64_t count = size();
+            stream.write(reinterpret_cast<const char*>(&detail::snapshot_magic),
+                         sizeof(detail::snapshot_magic));
+            stream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+
+            // gather the keys in heap order, so the loader can zip the two sections
+            // back together with a single linear pass
+            std::vector<Key> keys;
+            keys.reserve(count);
+            for (const auto& node : this->nodes) {
+                keys.emplace_back(key_at(node));
+            }
+
+            stream.write(reinterpret_cast<const char*>(keys.data()),
+                         static_cast<std::streamsize>(count * sizeof(Key)));
+            stream.write(reinterpret_cast<const char*>(this->nodes.data()),
+                         static_cast<std::streamsize>(count * sizeof(T)));
+        }
+
         // remove the top element.
         // Time: O(logN) amortized if using BinaryHeap, O(k*log_k(N)) amortized instead.
         // Space: O(1).
@@ -207,12 +932,12 @@ namespace priority_queue {
             assert(this->size() > 0);
 
             const std::size_t index_to_remove = 0;
-            const auto node = this->nodes.at(index_to_remove);
+            const auto node = this->node_at(index_to_remove);
             index_map.erase(node);
             key_map.erase(node);
 
             // replace root of the heap with the last element of the vector
-            this->nodes.at(0) = this->nodes.back();
+            this->node_at(0) = this->nodes.back();
 
             // remove the last element of the vector
             this->nodes.pop_back();
@@ -228,29 +953,13 @@ namespace priority_queue {
         }
     };
 
-    namespace detail {
-
-        inline auto min_heap_comp_factory = [](auto& key_map) {
-            return [&key_map](auto&& a, auto&& b) -> bool {
-                return key_map.at(a) > key_map.at(b);
-            };
-        };
-
-        inline auto max_heap_comp_factory = [](auto& key_map) {
-            return [&key_map](auto&& a, auto&& b) -> bool {
-                return key_map.at(a) < key_map.at(b);
-            };
-        };
-
-    }  // namespace detail
-
     // create a Priority Queue based on a Min Heap. It copies the given vectors.
     template <bool IsAlreadyHeap = false, typename Key, typename Value,
               typename THash = std::hash<Value>>
     auto make_min_priority_queue(const std::vector<Key>& keys, const std::vector<Value>& inputs) {
         using pq = PriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
                                  THash, Type::min_heap>;
-        return pq(keys, inputs, detail::min_heap_comp_factory);
+        return pq(keys, inputs);
     }
 
     // create a Priority Queue based on a Min Heap. It moves the given vectors.
@@ -259,7 +968,7 @@ namespace priority_queue {
     auto make_min_priority_queue(std::vector<Key>&& keys = {}, std::vector<Value>&& inputs = {}) {
         using pq = PriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
                                  THash, Type::min_heap>;
-        return pq(std::move(keys), std::move(inputs), detail::min_heap_comp_factory);
+        return pq(std::move(keys), std::move(inputs));
     }
 
     // create a Priority Queue based on a Max Heap. It copies the given vectors.
@@ -268,7 +977,7 @@ namespace priority_queue {
     auto make_max_priority_queue(const std::vector<Key>& keys, const std::vector<Value>& inputs) {
         using pq = PriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
                                  THash, Type::max_heap>;
-        return pq(keys, inputs, detail::max_heap_comp_factory);
+        return pq(keys, inputs);
     }
 
     // create a Priority Queue based on a Max Heap. It moves the given vectors.
@@ -277,7 +986,7 @@ namespace priority_queue {
     auto make_max_priority_queue(std::vector<Key>&& keys = {}, std::vector<Value>&& inputs = {}) {
         using pq = PriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
                                  THash, Type::max_heap>;
-        return pq(std::move(keys), std::move(inputs), detail::max_heap_comp_factory);
+        return pq(std::move(keys), std::move(inputs));
     }
 
     // create a Priority Queue based on a Min K-Heap. It copies the given vectors.
@@ -286,7 +995,7 @@ namespace priority_queue {
     auto make_min_k_priority_queue(const std::vector<Key>& keys, const std::vector<Value>& inputs) {
         using pq = PriorityQueue<heap::KHeap<K, Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
                                  THash, Type::min_heap>;
-        return pq(keys, inputs, detail::min_heap_comp_factory);
+        return pq(keys, inputs);
     }
 
     // create a Priority Queue based on a Min K-Heap. It moves the given vectors.
@@ -295,7 +1004,7 @@ namespace priority_queue {
     auto make_min_k_priority_queue(std::vector<Key>&& keys = {}, std::vector<Value>&& inputs = {}) {
         using pq = PriorityQueue<heap::KHeap<K, Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
                                  THash, Type::min_heap>;
-        return pq(std::move(keys), std::move(inputs), detail::min_heap_comp_factory);
+        return pq(std::move(keys), std::move(inputs));
     }
 
     // create a Priority Queue based on a Max K-Heap. It copies the given vectors.
@@ -304,7 +1013,7 @@ namespace priority_queue {
     auto make_max_k_priority_queue(const std::vector<Key>& keys, const std::vector<Value>& inputs) {
         using pq = PriorityQueue<heap::KHeap<K, Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
                                  THash, Type::max_heap>;
-        return pq(keys, inputs, detail::max_heap_comp_factory);
+        return pq(keys, inputs);
     }
 
     // create a Priority Queue based on a Max K-Heap. It moves the given vectors.
@@ -313,7 +1022,199 @@ namespace priority_queue {
     auto make_max_k_priority_queue(std::vector<Key>&& keys = {}, std::vector<Value>&& inputs = {}) {
         using pq = PriorityQueue<heap::KHeap<K, Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
                                  THash, Type::max_heap>;
-        return pq(std::move(keys), std::move(inputs), detail::max_heap_comp_factory);
+        return pq(std::move(keys), std::move(inputs));
+    }
+
+    // create a Priority Queue based on a Min Heap backed by the given allocator.
+    // It copies the given vectors.
+    template <bool IsAlreadyHeap = false, typename Key, typename Value, typename Allocator,
+              typename THash = std::hash<Value>>
+    auto make_min_priority_queue(const std::vector<Key>& keys, const std::vector<Value>& inputs,
+                                  const Allocator& allocator) {
+        using pq = PriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap, std::greater<Value>, void, Allocator>,
+                                 Key, Value, IsAlreadyHeap, THash, Type::min_heap>;
+        return pq(keys, inputs, allocator);
+    }
+
+    // create a Priority Queue based on a Min Heap backed by the given allocator.
+    // It moves the given vectors.
+    template <bool IsAlreadyHeap = false, typename Key, typename Value, typename Allocator,
+              typename THash = std::hash<Value>>
+    auto make_min_priority_queue(std::vector<Key>&& keys, std::vector<Value>&& inputs,
+                                  const Allocator& allocator) {
+        using pq = PriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap, std::greater<Value>, void, Allocator>,
+                                 Key, Value, IsAlreadyHeap, THash, Type::min_heap>;
+        return pq(std::move(keys), std::move(inputs), allocator);
+    }
+
+    // create a Priority Queue based on a Max Heap backed by the given allocator.
+    // It copies the given vectors.
+    template <bool IsAlreadyHeap = false, typename Key, typename Value, typename Allocator,
+              typename THash = std::hash<Value>>
+    auto make_max_priority_queue(const std::vector<Key>& keys, const std::vector<Value>& inputs,
+                                  const Allocator& allocator) {
+        using pq = PriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap, std::less<Value>, void, Allocator>,
+                                 Key, Value, IsAlreadyHeap, THash, Type::max_heap>;
+        return pq(keys, inputs, allocator);
+    }
+
+    // create a Priority Queue based on a Max Heap backed by the given allocator.
+    // It moves the given vectors.
+    template <bool IsAlreadyHeap = false, typename Key, typename Value, typename Allocator,
+              typename THash = std::hash<Value>>
+    auto make_max_priority_queue(std::vector<Key>&& keys, std::vector<Value>&& inputs,
+                                  const Allocator& allocator) {
+        using pq = PriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap, std::less<Value>, void, Allocator>,
+                                 Key, Value, IsAlreadyHeap, THash, Type::max_heap>;
+        return pq(std::move(keys), std::move(inputs), allocator);
+    }
+
+    // create a Priority Queue based on a Min K-Heap backed by the given allocator.
+    // It copies the given vectors.
+    template <std::size_t K, bool IsAlreadyHeap = false, typename Key, typename Value,
+              typename Allocator, typename THash = std::hash<Value>>
+    auto make_min_k_priority_queue(const std::vector<Key>& keys, const std::vector<Value>& inputs,
+                                    const Allocator& allocator) {
+        using pq = PriorityQueue<heap::KHeap<K, Value, IsAlreadyHeap, std::greater<Value>, false, void, Allocator>,
+                                 Key, Value, IsAlreadyHeap, THash, Type::min_heap>;
+        return pq(keys, inputs, allocator);
+    }
+
+    // create a Priority Queue based on a Min K-Heap backed by the given allocator.
+    // It moves the given vectors.
+    template <std::size_t K, bool IsAlreadyHeap = false, typename Key, typename Value,
+              typename Allocator, typename THash = std::hash<Value>>
+    auto make_min_k_priority_queue(std::vector<Key>&& keys, std::vector<Value>&& inputs,
+                                    const Allocator& allocator) {
+        using pq = PriorityQueue<heap::KHeap<K, Value, IsAlreadyHeap, std::greater<Value>, false, void, Allocator>,
+                                 Key, Value, IsAlreadyHeap, THash, Type::min_heap>;
+        return pq(std::move(keys), std::move(inputs), allocator);
+    }
+
+    // create a Priority Queue based on a Max K-Heap backed by the given allocator.
+    // It copies the given vectors.
+    template <std::size_t K, bool IsAlreadyHeap = false, typename Key, typename Value,
+              typename Allocator, typename THash = std::hash<Value>>
+    auto make_max_k_priority_queue(const std::vector<Key>& keys, const std::vector<Value>& inputs,
+                                    const Allocator& allocator) {
+        using pq = PriorityQueue<heap::KHeap<K, Value, IsAlreadyHeap, std::less<Value>, false, void, Allocator>,
+                                 Key, Value, IsAlreadyHeap, THash, Type::max_heap>;
+        return pq(keys, inputs, allocator);
+    }
+
+    // create a Priority Queue based on a Max K-Heap backed by the given allocator.
+    // It moves the given vectors.
+    template <std::size_t K, bool IsAlreadyHeap = false, typename Key, typename Value,
+              typename Allocator, typename THash = std::hash<Value>>
+    auto make_max_k_priority_queue(std::vector<Key>&& keys, std::vector<Value>&& inputs,
+                                    const Allocator& allocator) {
+        using pq = PriorityQueue<heap::KHeap<K, Value, IsAlreadyHeap, std::less<Value>, false, void, Allocator>,
+                                 Key, Value, IsAlreadyHeap, THash, Type::max_heap>;
+        return pq(std::move(keys), std::move(inputs), allocator);
+    }
+
+    // create a stable Priority Queue based on a Min Heap: equal keys pop in FIFO
+    // enqueue order. It copies the given vectors.
+    template <bool IsAlreadyHeap = false, typename Key, typename Value,
+              typename THash = std::hash<Value>>
+    auto make_min_stable_priority_queue(const std::vector<Key>& keys,
+                                        const std::vector<Value>& inputs) {
+        using pq = PriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
+                                 THash, Type::min_heap, true>;
+        return pq(keys, inputs);
+    }
+
+    // create a stable Priority Queue based on a Min Heap: equal keys pop in FIFO
+    // enqueue order. It moves the given vectors.
+    template <bool IsAlreadyHeap = false, typename Key, typename Value,
+              typename THash = std::hash<Value>>
+    auto make_min_stable_priority_queue(std::vector<Key>&& keys = {},
+                                        std::vector<Value>&& inputs = {}) {
+        using pq = PriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
+                                 THash, Type::min_heap, true>;
+        return pq(std::move(keys), std::move(inputs));
+    }
+
+    // create a stable Priority Queue based on a Max Heap: equal keys pop in FIFO
+    // enqueue order. It copies the given vectors.
+    template <bool IsAlreadyHeap = false, typename Key, typename Value,
+              typename THash = std::hash<Value>>
+    auto make_max_stable_priority_queue(const std::vector<Key>& keys,
+                                        const std::vector<Value>& inputs) {
+        using pq = PriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
+                                 THash, Type::max_heap, true>;
+        return pq(keys, inputs);
+    }
+
+    // create a stable Priority Queue based on a Max Heap: equal keys pop in FIFO
+    // enqueue order. It moves the given vectors.
+    template <bool IsAlreadyHeap = false, typename Key, typename Value,
+              typename THash = std::hash<Value>>
+    auto make_max_stable_priority_queue(std::vector<Key>&& keys = {},
+                                        std::vector<Value>&& inputs = {}) {
+        using pq = PriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
+                                 THash, Type::max_heap, true>;
+        return pq(std::move(keys), std::move(inputs));
+    }
+
+    // create an empty small-buffer Priority Queue based on a Min Heap: the node vector
+    // and both bookkeeping maps hold up to InlineCapacity entries inline, so queues
+    // that stay tiny (e.g. per-request candidate rankers) do zero allocations
+    template <std::size_t InlineCapacity, typename Key, typename Value,
+              typename THash = std::hash<Value>>
+    auto make_min_small_priority_queue() {
+        using engine = heap::BinaryHeap<Value, false, std::greater<Value>, void,
+                                        std::allocator<Value>, InlineCapacity>;
+        using pq = PriorityQueue<engine, Key, Value, false, THash, Type::min_heap, false,
+                                 InlineCapacity>;
+        return pq(std::vector<Key>{}, std::vector<Value>{});
+    }
+
+    // create an empty small-buffer Priority Queue based on a Max Heap
+    template <std::size_t InlineCapacity, typename Key, typename Value,
+              typename THash = std::hash<Value>>
+    auto make_max_small_priority_queue() {
+        using engine = heap::BinaryHeap<Value, false, std::less<Value>, void,
+                                        std::allocator<Value>, InlineCapacity>;
+        using pq = PriorityQueue<engine, Key, Value, false, THash, Type::max_heap, false,
+                                 InlineCapacity>;
+        return pq(std::vector<Key>{}, std::vector<Value>{});
+    }
+
+    // load a Min Priority Queue snapshot written by PriorityQueue::serialize().
+    // The nodes are already in heap order, so the queue is constructed through the
+    // IsAlreadyHeap path: O(n) map builds, no sifting.
+    template <typename Key, typename Value, typename THash = std::hash<Value>>
+    auto load_min_priority_queue(std::istream& stream) {
+        auto [keys, elements] = detail::read_snapshot<Key, Value>(stream);
+        return make_min_priority_queue<true, Key, Value, THash>(std::move(keys),
+                                                                std::move(elements));
+    }
+
+    // load a Max Priority Queue snapshot written by PriorityQueue::serialize()
+    template <typename Key, typename Value, typename THash = std::hash<Value>>
+    auto load_max_priority_queue(std::istream& stream) {
+        auto [keys, elements] = detail::read_snapshot<Key, Value>(stream);
+        return make_max_priority_queue<true, Key, Value, THash>(std::move(keys),
+                                                                std::move(elements));
+    }
+
+    // load a Min K-Heap Priority Queue snapshot written by PriorityQueue::serialize().
+    // K must match the arity the snapshot was taken with.
+    template <std::size_t K, typename Key, typename Value, typename THash = std::hash<Value>>
+    auto load_min_k_priority_queue(std::istream& stream) {
+        auto [keys, elements] = detail::read_snapshot<Key, Value>(stream);
+        return make_min_k_priority_queue<K, true, Key, Value, THash>(std::move(keys),
+                                                                     std::move(elements));
+    }
+
+    // load a Max K-Heap Priority Queue snapshot written by PriorityQueue::serialize().
+    // K must match the arity the snapshot was taken with.
+    template <std::size_t K, typename Key, typename Value, typename THash = std::hash<Value>>
+    auto load_max_k_priority_queue(std::istream& stream) {
+        auto [keys, elements] = detail::read_snapshot<Key, Value>(stream);
+        return make_max_k_priority_queue<K, true, Key, Value, THash>(std::move(keys),
+                                                                     std::move(elements));
     }
 
 }  // namespace priority_queue
@@ -0,0 +1,191 @@
+#ifndef RADIX_HEAP_H
+#define RADIX_HEAP_H
+
+#include <array>        // std::array
+#include <cassert>      // std::assert
+#include <cstddef>      // std::size_t
+#include <limits>       // std::numeric_limits
+#include <type_traits>  // std::is_unsigned_v
+#include <utility>      // std::move, std::pair
+#include <vector>       // std::vector
+
+namespace heap {
+
+    namespace detail {
+
+        // number of bits needed to represent x (0 for x == 0)
+        template <typename Key>
+        [[nodiscard]] constexpr std::size_t bit_width(Key x) noexcept {
+            std::size_t width = 0;
+
+            while (x != 0) {
+                x >>= 1;
+                width++;
+            }
+
+            return width;
+        }
+
+    }  // namespace detail
+
+    /**
+     * Monotone Min Priority Queue over unsigned integer keys, implemented as a radix
+     * heap (a.k.a. bucket queue). Entries live in digits+1 buckets indexed by the
+     * highest bit in which their key differs from the minimum key popped so far;
+     * push() is O(1) and every entry is redistributed into a strictly lower bucket at
+     * most digits times over its lifetime, so pop() is O(digits) amortized — no
+     * comparison sifting at all.
+     *
+     * The structure is MONOTONE: a pushed key must never be smaller than the key of
+     * the last popped entry (e.g. tentative distances in Dijkstra). The precondition
+     * is asserted in debug builds.
+     *
+     * RadixHeap stores (key, element) pairs directly and does not sift, so unlike
+     * BinaryHeap/KHeap it cannot be spliced into the CRTP chain under PriorityQueue;
+     * it exposes the same key/element surface itself and is obtained through the
+     * priority_queue::make_min_radix_priority_queue factory.
+     *
+     * Key: unsigned integer type of the keys used to order the elements.
+     * T: the type of the elements.
+     */
+    template <typename Key, typename T>
+    class RadixHeap {
+        static_assert(std::is_unsigned_v<Key>, "Key must be an unsigned integer type");
+
+        using entry_type = std::pair<Key, T>;
+
+        // one bucket per possible highest differing bit, plus bucket 0 for keys equal
+        // to the last popped key
+        static constexpr std::size_t num_buckets = std::numeric_limits<Key>::digits + 1;
+
+        std::array<std::vector<entry_type>, num_buckets> buckets;
+
+        // smallest key ever popped; the monotone floor of every live key
+        Key last_key = 0;
+
+        // total number of stored entries
+        std::size_t count = 0;
+
+        // return the bucket holding keys whose highest bit differing from last_key is
+        // the (index - 1)-th; keys equal to last_key go to bucket 0
+        [[nodiscard]] std::size_t bucket_index(const Key key) const noexcept {
+            return detail::bit_width(static_cast<Key>(key ^ last_key));
+        }
+
+        // ensure the next minimum sits in bucket 0: find the first non-empty bucket,
+        // advance last_key to its minimum key and redistribute its entries, each of
+        // which lands in a strictly lower bucket
+        void refill() {
+            if (!buckets[0].empty()) {
+                return;
+            }
+
+            assert(count > 0);
+
+            std::size_t first = 1;
+            while (buckets[first].empty()) {
+                first++;
+            }
+
+            Key min_key = buckets[first].front().first;
+            for (const auto& entry : buckets[first]) {
+                if (entry.first < min_key) {
+                    min_key = entry.first;
+                }
+            }
+
+            last_key = min_key;
+
+            for (auto& entry : buckets[first]) {
+                const std::size_t target = bucket_index(entry.first);
+                assert(target < first);
+
+                buckets[target].emplace_back(std::move(entry));
+            }
+
+            buckets[first].clear();
+        }
+
+    public:
+        RadixHeap() = default;
+        ~RadixHeap() = default;
+
+        // return the number of elements in the heap.
+        // Time: O(1).
+        [[nodiscard]] std::size_t size() const noexcept {
+            return count;
+        }
+
+        // return true iff the heap is empty.
+        // Time: O(1).
+        [[nodiscard]] bool empty() const noexcept {
+            return count == 0;
+        }
+
+        // add a new element with the given key. The key must not be smaller than the
+        // key of the last popped entry (monotonicity, asserted in debug builds).
+        // Time: O(1) amortized.
+        void push(const Key& key, const T& element) {
+            assert(key >= last_key);
+
+            buckets[bucket_index(key)].emplace_back(key, element);
+            count++;
+        }
+
+        // return the top (minimum-key) element. Might need to advance the bucket
+        // structure first, hence not const.
+        // Time: O(digits) amortized.
+        [[nodiscard]] const T& top() {
+            assert(count > 0);
+            refill();
+
+            return buckets[0].back().second;
+        }
+
+        // return the top (key, element) pair.
+        // Time: O(digits) amortized.
+        [[nodiscard]] const entry_type& top_key_value() {
+            assert(count > 0);
+            refill();
+
+            return buckets[0].back();
+        }
+
+        // remove the top element and return its (key, element) pair.
+        // Time: O(digits) amortized.
+        [[nodiscard]] entry_type pop_top() {
+            assert(count > 0);
+            refill();
+
+            entry_type entry = std::move(buckets[0].back());
+            buckets[0].pop_back();
+            count--;
+
+            return entry;
+        }
+
+        // remove the top element.
+        // Time: O(digits) amortized.
+        void pop() {
+            assert(count > 0);
+            refill();
+
+            buckets[0].pop_back();
+            count--;
+        }
+    };
+
+}  // namespace heap
+
+namespace priority_queue {
+
+    // create a monotone Min Priority Queue over unsigned integer keys, backed by a
+    // radix heap instead of a comparison-based heap
+    template <typename Key, typename Value>
+    [[nodiscard]] auto make_min_radix_priority_queue() {
+        return heap::RadixHeap<Key, Value>();
+    }
+
+}  // namespace priority_queue
+
+#endif  // RADIX_HEAP_H
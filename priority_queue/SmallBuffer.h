@@ -0,0 +1,485 @@
+#ifndef SMALL_BUFFER_H
+#define SMALL_BUFFER_H
+
+#include <algorithm>    // std::max, std::move_backward, std::rotate
+#include <cassert>      // std::assert
+#include <cstddef>      // std::size_t
+#include <iterator>     // std::distance, std::make_move_iterator
+#include <memory>       // std::allocator, std::allocator_traits
+#include <stdexcept>    // std::out_of_range
+#include <type_traits>  // std::aligned_storage_t
+#include <utility>      // std::forward, std::move, std::pair
+
+namespace heap {
+
+    namespace detail {
+
+        /**
+         * Small-buffer-optimized vector: the first InlineCapacity elements live in an
+         * inline array inside the object itself, so tiny containers never touch the
+         * allocator; past the threshold the storage spills to allocated memory and the
+         * container behaves like a plain std::vector. Only the subset of the vector
+         * interface used by the Heap hierarchy is provided.
+         *
+         * T: the type of the stored elements.
+         * InlineCapacity: number of elements held inline before spilling.
+         * Allocator: allocator used for the spilled storage.
+         */
+        template <typename T, std::size_t InlineCapacity, typename Allocator = std::allocator<T>>
+        class small_vector {
+            static_assert(InlineCapacity > 0, "InlineCapacity must be positive");
+
+            using alloc_traits = std::allocator_traits<Allocator>;
+
+            // raw inline slots; elements are constructed in place as they are added
+            std::aligned_storage_t<sizeof(T), alignof(T)> inline_storage[InlineCapacity];
+
+            T* first = inline_buffer();
+            std::size_t count = 0;
+            std::size_t cap = InlineCapacity;
+            Allocator alloc;
+
+            [[nodiscard]] T* inline_buffer() noexcept {
+                return reinterpret_cast<T*>(inline_storage);
+            }
+
+            [[nodiscard]] const T* inline_buffer() const noexcept {
+                return reinterpret_cast<const T*>(inline_storage);
+            }
+
+            [[nodiscard]] bool is_inline() const noexcept {
+                return first == inline_buffer();
+            }
+
+            // move the elements into a fresh allocation of at least new_cap slots
+            void grow_to(const std::size_t new_cap) {
+                T* const new_first = alloc_traits::allocate(alloc, new_cap);
+
+                for (std::size_t i = 0; i < count; ++i) {
+                    alloc_traits::construct(alloc, new_first + i, std::move(first[i]));
+                    alloc_traits::destroy(alloc, first + i);
+                }
+
+                if (!is_inline()) {
+                    alloc_traits::deallocate(alloc, first, cap);
+                }
+
+                first = new_first;
+                cap = new_cap;
+            }
+
+            void destroy_all() noexcept {
+                for (std::size_t i = 0; i < count; ++i) {
+                    alloc_traits::destroy(alloc, first + i);
+                }
+
+                count = 0;
+            }
+
+        public:
+            using value_type = T;
+            using iterator = T*;
+            using const_iterator = const T*;
+
+            small_vector() = default;
+
+            explicit small_vector(const Allocator& allocator) : alloc(allocator) {
+            }
+
+            template <typename InputIt>
+            small_vector(InputIt input_first, InputIt input_last) {
+                for (; input_first != input_last; ++input_first) {
+                    emplace_back(*input_first);
+                }
+            }
+
+            template <typename InputIt>
+            small_vector(InputIt input_first, InputIt input_last, const Allocator& allocator) :
+                alloc(allocator) {
+                for (; input_first != input_last; ++input_first) {
+                    emplace_back(*input_first);
+                }
+            }
+
+            small_vector(const small_vector& other) : alloc(other.alloc) {
+                reserve(other.count);
+                for (std::size_t i = 0; i < other.count; ++i) {
+                    emplace_back(other.first[i]);
+                }
+            }
+
+            small_vector(small_vector&& other) : alloc(std::move(other.alloc)) {
+                if (other.is_inline()) {
+                    for (std::size_t i = 0; i < other.count; ++i) {
+                        emplace_back(std::move(other.first[i]));
+                    }
+                    other.destroy_all();
+                } else {
+                    // steal the spilled allocation wholesale
+                    first = other.first;
+                    count = other.count;
+                    cap = other.cap;
+                    other.first = other.inline_buffer();
+                    other.count = 0;
+                    other.cap = InlineCapacity;
+                }
+            }
+
+            small_vector& operator=(const small_vector& other) {
+                if (this != &other) {
+                    clear();
+                    reserve(other.count);
+                    for (std::size_t i = 0; i < other.count; ++i) {
+                        emplace_back(other.first[i]);
+                    }
+                }
+                return *this;
+            }
+
+            small_vector& operator=(small_vector&& other) {
+                if (this != &other) {
+                    clear();
+
+                    if (other.is_inline()) {
+                        for (std::size_t i = 0; i < other.count; ++i) {
+                            emplace_back(std::move(other.first[i]));
+                        }
+                        other.destroy_all();
+                    } else {
+                        if (!is_inline()) {
+                            alloc_traits::deallocate(alloc, first, cap);
+                        }
+                        first = other.first;
+                        count = other.count;
+                        cap = other.cap;
+                        other.first = other.inline_buffer();
+                        other.count = 0;
+                        other.cap = InlineCapacity;
+                    }
+                }
+                return *this;
+            }
+
+            ~small_vector() {
+                destroy_all();
+
+                if (!is_inline()) {
+                    alloc_traits::deallocate(alloc, first, cap);
+                }
+            }
+
+            [[nodiscard]] std::size_t size() const noexcept {
+                return count;
+            }
+
+            [[nodiscard]] std::size_t capacity() const noexcept {
+                return cap;
+            }
+
+            [[nodiscard]] bool empty() const noexcept {
+                return count == 0;
+            }
+
+            [[nodiscard]] T* data() noexcept {
+                return first;
+            }
+
+            [[nodiscard]] const T* data() const noexcept {
+                return first;
+            }
+
+            [[nodiscard]] iterator begin() noexcept {
+                return first;
+            }
+
+            [[nodiscard]] const_iterator begin() const noexcept {
+                return first;
+            }
+
+            [[nodiscard]] iterator end() noexcept {
+                return first + count;
+            }
+
+            [[nodiscard]] const_iterator end() const noexcept {
+                return first + count;
+            }
+
+            [[nodiscard]] T& operator[](const std::size_t i) {
+                assert(i < count);
+                return first[i];
+            }
+
+            [[nodiscard]] const T& operator[](const std::size_t i) const {
+                assert(i < count);
+                return first[i];
+            }
+
+            [[nodiscard]] T& at(const std::size_t i) {
+                if (i >= count) {
+                    throw std::out_of_range("small_vector::at");
+                }
+                return first[i];
+            }
+
+            [[nodiscard]] const T& at(const std::size_t i) const {
+                if (i >= count) {
+                    throw std::out_of_range("small_vector::at");
+                }
+                return first[i];
+            }
+
+            [[nodiscard]] T& front() {
+                assert(count > 0);
+                return first[0];
+            }
+
+            [[nodiscard]] const T& front() const {
+                assert(count > 0);
+                return first[0];
+            }
+
+            [[nodiscard]] T& back() {
+                assert(count > 0);
+                return first[count - 1];
+            }
+
+            [[nodiscard]] const T& back() const {
+                assert(count > 0);
+                return first[count - 1];
+            }
+
+            void reserve(const std::size_t new_cap) {
+                if (new_cap > cap) {
+                    grow_to(new_cap);
+                }
+            }
+
+            void clear() noexcept {
+                destroy_all();
+            }
+
+            template <class... Args>
+            T& emplace_back(Args&&... args) {
+                if (count == cap) {
+                    grow_to(std::max<std::size_t>(cap * 2, 1));
+                }
+
+                alloc_traits::construct(alloc, first + count, std::forward<Args>(args)...);
+                count++;
+
+                return first[count - 1];
+            }
+
+            void push_back(const T& value) {
+                emplace_back(value);
+            }
+
+            void push_back(T&& value) {
+                emplace_back(std::move(value));
+            }
+
+            void pop_back() {
+                assert(count > 0);
+
+                count--;
+                alloc_traits::destroy(alloc, first + count);
+            }
+
+            // append-then-rotate insert: simpler than the raw-memory juggling of the
+            // general case, and the Heap call sites insert at the end anyway
+            template <typename InputIt,
+                      typename = typename std::iterator_traits<InputIt>::iterator_category>
+            iterator insert(const_iterator pos, InputIt input_first, InputIt input_last) {
+                const std::size_t index = static_cast<std::size_t>(pos - first);
+                const std::size_t old_count = count;
+
+                for (; input_first != input_last; ++input_first) {
+                    emplace_back(*input_first);
+                }
+
+                std::rotate(first + index, first + old_count, first + count);
+
+                return first + index;
+            }
+
+            iterator insert(const_iterator pos, std::size_t n, const T& value) {
+                const std::size_t index = static_cast<std::size_t>(pos - first);
+                const std::size_t old_count = count;
+
+                for (std::size_t i = 0; i < n; ++i) {
+                    emplace_back(value);
+                }
+
+                std::rotate(first + index, first + old_count, first + count);
+
+                return first + index;
+            }
+
+            iterator erase(const_iterator erase_first, const_iterator erase_last) {
+                const std::size_t from = static_cast<std::size_t>(erase_first - first);
+                const std::size_t to = static_cast<std::size_t>(erase_last - first);
+                const std::size_t n = to - from;
+
+                for (std::size_t i = to; i < count; ++i) {
+                    first[i - n] = std::move(first[i]);
+                }
+
+                for (std::size_t i = count - n; i < count; ++i) {
+                    alloc_traits::destroy(alloc, first + i);
+                }
+
+                count -= n;
+
+                return first + from;
+            }
+        };
+
+    }  // namespace detail
+
+}  // namespace heap
+
+namespace priority_queue {
+
+    namespace detail {
+
+        /**
+         * Flat small map: an unsorted array of (key, value) entries with linear-scan
+         * lookup, backed by heap::detail::small_vector so that maps up to
+         * InlineCapacity entries never allocate. Meant as a drop-in for the
+         * unordered_map bookkeeping of tiny priority queues, where a linear scan over
+         * a cache-resident array beats hashing; only the map subset PriorityQueue uses
+         * is provided.
+         *
+         * Key: the lookup key type, compared with operator==.
+         * Value: the mapped type.
+         * InlineCapacity: number of entries held inline before spilling.
+         */
+        template <typename Key, typename Value, std::size_t InlineCapacity>
+        class flat_map {
+            using entry_type = std::pair<Key, Value>;
+
+            heap::detail::small_vector<entry_type, InlineCapacity> entries;
+
+        public:
+            // flat maps never take a caller allocator (the whole point is staying
+            // inline); the alias only keeps allocator-taking call sites compilable
+            using allocator_type = std::allocator<entry_type>;
+
+            using iterator = typename heap::detail::small_vector<entry_type,
+                                                                 InlineCapacity>::iterator;
+            using const_iterator =
+                typename heap::detail::small_vector<entry_type, InlineCapacity>::const_iterator;
+
+            [[nodiscard]] std::size_t size() const noexcept {
+                return entries.size();
+            }
+
+            [[nodiscard]] bool empty() const noexcept {
+                return entries.empty();
+            }
+
+            [[nodiscard]] iterator begin() noexcept {
+                return entries.begin();
+            }
+
+            [[nodiscard]] const_iterator begin() const noexcept {
+                return entries.begin();
+            }
+
+            [[nodiscard]] iterator end() noexcept {
+                return entries.end();
+            }
+
+            [[nodiscard]] const_iterator end() const noexcept {
+                return entries.end();
+            }
+
+            void reserve(const std::size_t capacity) {
+                entries.reserve(capacity);
+            }
+
+            void clear() noexcept {
+                entries.clear();
+            }
+
+            [[nodiscard]] iterator find(const Key& key) {
+                for (auto it = entries.begin(); it != entries.end(); ++it) {
+                    if (it->first == key) {
+                        return it;
+                    }
+                }
+                return entries.end();
+            }
+
+            [[nodiscard]] const_iterator find(const Key& key) const {
+                for (auto it = entries.begin(); it != entries.end(); ++it) {
+                    if (it->first == key) {
+                        return it;
+                    }
+                }
+                return entries.end();
+            }
+
+            [[nodiscard]] std::size_t count(const Key& key) const {
+                return find(key) != end() ? 1 : 0;
+            }
+
+            [[nodiscard]] Value& at(const Key& key) {
+                const auto search = find(key);
+                if (search == end()) {
+                    throw std::out_of_range("flat_map::at");
+                }
+                return search->second;
+            }
+
+            [[nodiscard]] const Value& at(const Key& key) const {
+                const auto search = find(key);
+                if (search == end()) {
+                    throw std::out_of_range("flat_map::at");
+                }
+                return search->second;
+            }
+
+            Value& operator[](const Key& key) {
+                const auto search = find(key);
+                if (search != end()) {
+                    return search->second;
+                }
+                return entries.emplace_back(key, Value{}).second;
+            }
+
+            std::size_t erase(const Key& key) {
+                const auto search = find(key);
+                if (search == end()) {
+                    return 0;
+                }
+
+                // order is irrelevant: overwrite with the last entry and shrink
+                *search = std::move(entries.back());
+                entries.pop_back();
+
+                return 1;
+            }
+
+            // move the entries of other whose keys aren't present here, mirroring
+            // std::unordered_map::merge; entries with colliding keys stay in other
+            void merge(flat_map&& other) {
+                heap::detail::small_vector<entry_type, InlineCapacity> kept;
+
+                for (auto& entry : other.entries) {
+                    if (find(entry.first) == end()) {
+                        entries.emplace_back(std::move(entry));
+                    } else {
+                        kept.emplace_back(std::move(entry));
+                    }
+                }
+
+                other.entries = std::move(kept);
+            }
+        };
+
+    }  // namespace detail
+
+}  // namespace priority_queue
+
+#endif  // SMALL_BUFFER_H
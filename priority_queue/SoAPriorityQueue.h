@@ -0,0 +1,385 @@
+#ifndef SOA_PRIORITY_QUEUE_H
+#define SOA_PRIORITY_QUEUE_H
+
+#include <algorithm>      // std::swap
+#include <cassert>        // std::assert
+#include <cstddef>        // std::size_t
+#include <functional>     // std::hash, std::greater, std::less
+#include <type_traits>    // std::conditional_t, std::is_base_of
+#include <unordered_map>  // std::unordered_map
+#include <utility>        // std::move, std::pair
+#include <vector>         // std::vector
+
+#include "BinaryHeap.h"
+#include "Heap.h"
+#include "KHeap.h"
+#include "PriorityQueue.h"
+
+namespace priority_queue {
+
+    /**
+     * Priority Queue with a structure-of-arrays layout: the heap array stores the KEYS
+     * themselves, so every comparison during a sift touches contiguous keys with perfect
+     * locality, while the payloads sit untouched in a stable slab indexed by small
+     * handles. A parallel handle array follows the heap order, so swapping two nodes
+     * moves a (key, handle) pair instead of dragging fat payloads through the cache;
+     * the payload is only dereferenced at top()/pop_top().
+     *
+     * Compared with PriorityQueue, which stores the payload in the heap and indirects
+     * through key_map on every comparison, this engine is the better fit when T is big
+     * or expensive to move; PriorityQueue stays preferable for small payloads, where the
+     * extra handle array is pure overhead.
+     * This class shouldn't be invoked directly.
+     * Instead, the factories make_min_soa_priority_queue etc. should be used.
+     *
+     * Heap: the heap engine ordering the keys (BinaryHeap or KHeap of Key).
+     * Key: type of the keys used to order the elements.
+     * T: the type of the payload elements. Must be hashable.
+     * IsAlreadyHeap: constexpr bool flag. If true, build_heap() won't be called
+     *                after the class is constructed.
+     * THash: hash functor type for the payload elements.
+     * HeapType: min_heap or max_heap flavor.
+     */
+    template <class Heap, typename Key, typename T, bool IsAlreadyHeap = false,
+              typename THash = std::hash<T>, Type HeapType = Type::min_heap>
+    class SoAPriorityQueue
+        : private Heap::template rebind<
+              std::conditional_t<HeapType == Type::min_heap, std::greater<Key>, std::less<Key>>,
+              SoAPriorityQueue<Heap, Key, T, IsAlreadyHeap, THash, HeapType>> {
+        // the heap orders plain keys, so no key_map indirection is involved at all
+        using compare_type =
+            std::conditional_t<HeapType == Type::min_heap, std::greater<Key>, std::less<Key>>;
+
+        using super = typename Heap::template rebind<compare_type, SoAPriorityQueue>;
+
+        // the heap classes reach the protected members of this class through self()
+        friend super;
+        friend class heap::Heap<SoAPriorityQueue, Key, compare_type, IsAlreadyHeap,
+                                typename Heap::allocator_type>;
+
+        static_assert(std::is_base_of<heap::Heap<SoAPriorityQueue, Key, compare_type,
+                                                 IsAlreadyHeap, typename Heap::allocator_type>,
+                                      super>::value,
+                      "Heap must derive heap::Heap");
+
+        // stable payload slab; slots are never moved, only reused through free_slots
+        std::vector<T> slab;
+
+        // free slab slots, reused before the slab grows
+        std::vector<std::size_t> free_slots;
+
+        // handles[position] -> slab slot of the node at the given heap position.
+        // Kept parallel to this->nodes (which holds the keys in heap order).
+        std::vector<std::size_t> handles;
+
+        // slot_to_position[slot] -> heap position of the node stored in the given slot
+        std::vector<std::size_t> slot_to_position;
+
+        // element_to_slot[element] -> slab slot, for update_key()/contains()
+        std::unordered_map<T, std::size_t, THash> element_to_slot;
+
+        // slab slot of the node being sifted: the sift hooks below move keys, and this
+        // member carries the matching handle from the start of the sift to place_node()
+        std::size_t moving_slot = 0;
+
+        // take a free slab slot, or grow the slab by one
+        [[nodiscard]] std::size_t allocate_slot(const T& element) {
+            if (!free_slots.empty()) {
+                const std::size_t slot = free_slots.back();
+                free_slots.pop_back();
+                slab[slot] = element;
+                return slot;
+            }
+
+            slab.emplace_back(element);
+            slot_to_position.emplace_back(0);
+            return slab.size() - 1;
+        }
+
+    protected:
+        // keep the handle array and the slot positions in sync with the key swap
+        void swap_nodes(const std::size_t i, const std::size_t j) {
+            std::swap(this->node_at(i), this->node_at(j));
+            std::swap(handles[i], handles[j]);
+            slot_to_position[handles[i]] = i;
+            slot_to_position[handles[j]] = j;
+        }
+
+        // hole-based sift support: shift the (key, handle) pair, one position write each
+        void shift_node(const std::size_t dst, const std::size_t src) {
+            this->node_at(dst) = std::move(this->node_at(src));
+            handles[dst] = handles[src];
+            slot_to_position[handles[dst]] = dst;
+        }
+
+        // write the moving key and its handle (saved in moving_slot) into the hole
+        void place_node(const std::size_t index, Key&& key) {
+            this->node_at(index) = std::move(key);
+            handles[index] = moving_slot;
+            slot_to_position[moving_slot] = index;
+        }
+
+        // sift wrappers that capture the handle of the moving node before the key-only
+        // machinery of the heap bases runs
+        void heapify_up(const std::size_t index) {
+            moving_slot = handles[index];
+            super::heapify_up(index);
+        }
+
+        void heapify_down(const std::size_t index) {
+            moving_slot = handles[index];
+            super::heapify_down(index);
+        }
+
+        // arity-agnostic Floyd pass: heapify_down() returns in O(1) on leaves, so
+        // visiting every position keeps the overall O(n) bound
+        void build_heap() {
+            for (std::size_t i = this->nodes.size(); i > 0; --i) {
+                heapify_down(i - 1);
+            }
+        }
+
+    public:
+        SoAPriorityQueue() = delete;
+
+        explicit SoAPriorityQueue(const std::vector<Key>& keys, const std::vector<T>& inputs) :
+            super(keys), slab(inputs) {
+            assert(keys.size() == inputs.size());
+
+            const std::size_t n = inputs.size();
+
+            handles.resize(n);
+            slot_to_position.resize(n);
+            element_to_slot.reserve(n);
+
+            for (std::size_t i = 0; i < n; ++i) {
+                handles[i] = i;
+                slot_to_position[i] = i;
+                element_to_slot[slab[i]] = i;
+            }
+
+            this->init();
+        }
+
+        explicit SoAPriorityQueue(std::vector<Key>&& keys, std::vector<T>&& inputs) :
+            super(std::move(keys)), slab(std::move(inputs)) {
+            assert(this->nodes.size() == slab.size());
+
+            const std::size_t n = slab.size();
+
+            handles.resize(n);
+            slot_to_position.resize(n);
+            element_to_slot.reserve(n);
+
+            for (std::size_t i = 0; i < n; ++i) {
+                handles[i] = i;
+                slot_to_position[i] = i;
+                element_to_slot[slab[i]] = i;
+            }
+
+            this->init();
+        }
+
+        ~SoAPriorityQueue() = default;
+
+        // return the number of elements in the queue.
+        // Time: O(1).
+        [[nodiscard]] std::size_t size() const noexcept {
+            return super::size();
+        }
+
+        // return true iff the queue is empty.
+        // Time: O(1).
+        [[nodiscard]] bool empty() const noexcept {
+            return super::empty();
+        }
+
+        // add a new element with the given key.
+        // Time: O(logN) amortized, touching only the contiguous key array.
+        void push(const Key& key, const T& element) {
+            const std::size_t slot = allocate_slot(element);
+            element_to_slot[element] = slot;
+
+            const std::size_t index_to_fix = this->nodes.size();
+            this->nodes.emplace_back(key);
+            handles.emplace_back(slot);
+
+            heapify_up(index_to_fix);
+        }
+
+        // update the key of the given element (which must exist), in either direction.
+        // Time: O(logN) amortized.
+        void update_key(const Key& key, const T& element) {
+            const std::size_t slot = element_to_slot.at(element);
+            const std::size_t index = slot_to_position[slot];
+
+            const Key old_key = std::move(this->node_at(index));
+            this->node_at(index) = key;
+
+            // comp answers "is a ordered after b", so a new key beating the old one
+            // can only promote the node; any other change may demote it below its
+            // children and needs the downward sift
+            if (this->comp(old_key, key)) {
+                heapify_up(index);
+            } else {
+                heapify_down(index);
+            }
+        }
+
+        // return the key of the given element (which must exist).
+        // Time: O(1) amortized.
+        [[nodiscard]] const Key& key_at(const T& element) const {
+            return this->node_at(slot_to_position[element_to_slot.at(element)]);
+        }
+
+        // return true iff the queue contains the given element.
+        // Time: O(1) amortized.
+        [[nodiscard]] bool contains(const T& element) const {
+            return element_to_slot.count(element) > 0;
+        }
+
+        // return the top element. The payload slab is only touched here.
+        // Time: O(1).
+        [[nodiscard]] const T& top() const {
+            assert(size() > 0);
+
+            return slab[handles[0]];
+        }
+
+        // return the key of the top element.
+        // Time: O(1).
+        [[nodiscard]] const Key& top_key() const {
+            assert(size() > 0);
+
+            return this->node_at(0);
+        }
+
+        // remove the top element and return its (key, element) pair.
+        // Time: O(logN) amortized.
+        [[nodiscard]] std::pair<Key, T> pop_top() {
+            assert(size() > 0);
+
+            const std::size_t slot = handles[0];
+            std::pair<Key, T> result(std::move(this->node_at(0)), std::move(slab[slot]));
+
+            element_to_slot.erase(result.second);
+            free_slots.emplace_back(slot);
+
+            this->node_at(0) = std::move(this->nodes.back());
+            handles[0] = handles.back();
+            this->nodes.pop_back();
+            handles.pop_back();
+
+            if (!this->nodes.empty()) {
+                slot_to_position[handles[0]] = 0;
+                heapify_down(0);
+            }
+
+            return result;
+        }
+
+        // remove the top element.
+        // Time: O(logN) amortized.
+        void pop() {
+            assert(size() > 0);
+
+            const std::size_t slot = handles[0];
+
+            element_to_slot.erase(slab[slot]);
+            free_slots.emplace_back(slot);
+
+            this->node_at(0) = std::move(this->nodes.back());
+            handles[0] = handles.back();
+            this->nodes.pop_back();
+            handles.pop_back();
+
+            if (!this->nodes.empty()) {
+                slot_to_position[handles[0]] = 0;
+                heapify_down(0);
+            }
+        }
+    };
+
+    // create a SoA Priority Queue based on a Min Heap. It copies the given vectors.
+    template <bool IsAlreadyHeap = false, typename Key, typename Value,
+              typename THash = std::hash<Value>>
+    auto make_min_soa_priority_queue(const std::vector<Key>& keys,
+                                     const std::vector<Value>& inputs) {
+        using pq = SoAPriorityQueue<heap::BinaryHeap<Key, IsAlreadyHeap>, Key, Value,
+                                    IsAlreadyHeap, THash, Type::min_heap>;
+        return pq(keys, inputs);
+    }
+
+    // create a SoA Priority Queue based on a Min Heap. It moves the given vectors.
+    template <bool IsAlreadyHeap = false, typename Key, typename Value,
+              typename THash = std::hash<Value>>
+    auto make_min_soa_priority_queue(std::vector<Key>&& keys = {},
+                                     std::vector<Value>&& inputs = {}) {
+        using pq = SoAPriorityQueue<heap::BinaryHeap<Key, IsAlreadyHeap>, Key, Value,
+                                    IsAlreadyHeap, THash, Type::min_heap>;
+        return pq(std::move(keys), std::move(inputs));
+    }
+
+    // create a SoA Priority Queue based on a Max Heap. It copies the given vectors.
+    template <bool IsAlreadyHeap = false, typename Key, typename Value,
+              typename THash = std::hash<Value>>
+    auto make_max_soa_priority_queue(const std::vector<Key>& keys,
+                                     const std::vector<Value>& inputs) {
+        using pq = SoAPriorityQueue<heap::BinaryHeap<Key, IsAlreadyHeap>, Key, Value,
+                                    IsAlreadyHeap, THash, Type::max_heap>;
+        return pq(keys, inputs);
+    }
+
+    // create a SoA Priority Queue based on a Max Heap. It moves the given vectors.
+    template <bool IsAlreadyHeap = false, typename Key, typename Value,
+              typename THash = std::hash<Value>>
+    auto make_max_soa_priority_queue(std::vector<Key>&& keys = {},
+                                     std::vector<Value>&& inputs = {}) {
+        using pq = SoAPriorityQueue<heap::BinaryHeap<Key, IsAlreadyHeap>, Key, Value,
+                                    IsAlreadyHeap, THash, Type::max_heap>;
+        return pq(std::move(keys), std::move(inputs));
+    }
+
+    // create a SoA Priority Queue based on a Min K-Heap. It copies the given vectors.
+    template <std::size_t K, bool IsAlreadyHeap = false, typename Key, typename Value,
+              typename THash = std::hash<Value>>
+    auto make_min_soa_k_priority_queue(const std::vector<Key>& keys,
+                                       const std::vector<Value>& inputs) {
+        using pq = SoAPriorityQueue<heap::KHeap<K, Key, IsAlreadyHeap>, Key, Value,
+                                    IsAlreadyHeap, THash, Type::min_heap>;
+        return pq(keys, inputs);
+    }
+
+    // create a SoA Priority Queue based on a Min K-Heap. It moves the given vectors.
+    template <std::size_t K, bool IsAlreadyHeap = false, typename Key, typename Value,
+              typename THash = std::hash<Value>>
+    auto make_min_soa_k_priority_queue(std::vector<Key>&& keys = {},
+                                       std::vector<Value>&& inputs = {}) {
+        using pq = SoAPriorityQueue<heap::KHeap<K, Key, IsAlreadyHeap>, Key, Value,
+                                    IsAlreadyHeap, THash, Type::min_heap>;
+        return pq(std::move(keys), std::move(inputs));
+    }
+
+    // create a SoA Priority Queue based on a Max K-Heap. It copies the given vectors.
+    template <std::size_t K, bool IsAlreadyHeap = false, typename Key, typename Value,
+              typename THash = std::hash<Value>>
+    auto make_max_soa_k_priority_queue(const std::vector<Key>& keys,
+                                       const std::vector<Value>& inputs) {
+        using pq = SoAPriorityQueue<heap::KHeap<K, Key, IsAlreadyHeap>, Key, Value,
+                                    IsAlreadyHeap, THash, Type::max_heap>;
+        return pq(keys, inputs);
+    }
+
+    // create a SoA Priority Queue based on a Max K-Heap. It moves the given vectors.
+    template <std::size_t K, bool IsAlreadyHeap = false, typename Key, typename Value,
+              typename THash = std::hash<Value>>
+    auto make_max_soa_k_priority_queue(std::vector<Key>&& keys = {},
+                                       std::vector<Value>&& inputs = {}) {
+        using pq = SoAPriorityQueue<heap::KHeap<K, Key, IsAlreadyHeap>, Key, Value,
+                                    IsAlreadyHeap, THash, Type::max_heap>;
+        return pq(std::move(keys), std::move(inputs));
+    }
+
+}  // namespace priority_queue
+
+#endif  // SOA_PRIORITY_QUEUE_H
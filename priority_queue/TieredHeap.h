@@ -0,0 +1,172 @@
+#ifndef TIERED_HEAP_H
+#define TIERED_HEAP_H
+
+#include <cassert>     // std::assert
+#include <cstddef>     // std::size_t
+#include <functional>  // std::greater, std::less
+#include <utility>     // std::move
+#include <vector>      // std::vector
+
+#include "BinaryHeap.h"
+#include "Heap.h"
+#include "KHeap.h"
+
+namespace heap {
+
+    /**
+     * Two-tier heap for workloads where N*sizeof(T) far exceeds the last-level cache.
+     * In that regime every level of a flat binary heap below the first few is a
+     * guaranteed cache miss, on pushes and pops alike.
+     *
+     * The main tier is the cache-aligned K-ary heap (KHeap with CacheAligned = true):
+     * every group of K siblings occupies exactly one cache line, and the K-ary shape
+     * divides the depth — and with it the number of distinct lines a sift touches — by
+     * log2(K) compared with a binary heap. The insert tier is a small cache-resident
+     * binary heap that absorbs every push; only when it fills is it flushed into the
+     * main tier in one bulk append, which recovers the heap property once at the end
+     * (sift_appended()'s cost model) instead of paying a full out-of-cache sift per
+     * element. top()/pop() consult the better of the two tier tops.
+     *
+     * This is the sequence-heap idea reduced to two tiers; a full funnel/van Emde Boas
+     * layout would not fit the flat-vector machinery the heap hierarchy is built on.
+     * The tiers migrate elements wholesale, so unlike BinaryHeap/KHeap this engine
+     * cannot be spliced under the position-tracking PriorityQueue; it exposes the
+     * plain heap surface and is obtained through the make_min/max_tiered_heap
+     * factories.
+     *
+     * T: the type of the objects stored in the heap.
+     * Compare: type of the comparison functor.
+     *          std::greater<T> yields a Min Heap, std::less<T> a Max Heap.
+     * K: arity of the main tier; 16 packs one cache line of 4-byte elements per group.
+     */
+    template <typename T, typename Compare = std::greater<T>, std::size_t K = 16>
+    class TieredHeap {
+        using main_tier_type = KHeap<K, T, false, Compare, true>;
+        using insert_tier_type = BinaryHeap<T, false, Compare>;
+
+        // number of elements the insert tier holds before it is flushed; the default
+        // keeps the whole tier comfortably inside a typical L2
+        static constexpr std::size_t default_buffer_capacity = std::size_t{1} << 12;
+
+        main_tier_type main_tier;
+        insert_tier_type insert_tier;
+        std::size_t buffer_capacity;
+
+        // comparison functor, stored inline like in the Heap base.
+        // std::greater<T> -> Min Heap
+        // std::less<T>    -> Max Heap
+        Compare comp;
+
+        // true iff the next pop must come from the insert tier
+        [[nodiscard]] bool insert_tier_wins() const {
+            if (insert_tier.empty()) {
+                return false;
+            }
+            if (main_tier.empty()) {
+                return true;
+            }
+
+            // comp answers "is a ordered after b"
+            return comp(main_tier.top(), insert_tier.top());
+        }
+
+    public:
+        // disable public default constructor
+        TieredHeap() = delete;
+
+        explicit TieredHeap(Compare comp,
+                            const std::size_t buffer_capacity = default_buffer_capacity) :
+            main_tier(std::vector<T>{}, comp),
+            insert_tier(std::vector<T>{}, comp),
+            buffer_capacity(buffer_capacity),
+            comp(std::move(comp)) {
+            assert(buffer_capacity > 0);
+        }
+
+        ~TieredHeap() = default;
+
+        // return the number of elements across both tiers
+        [[nodiscard]] std::size_t size() const noexcept {
+            return main_tier.size() + insert_tier.size();
+        }
+
+        // return true iff the heap is empty
+        [[nodiscard]] bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        // pre-size the main tier for the given number of elements
+        void reserve(const std::size_t capacity) {
+            main_tier.reserve(capacity);
+        }
+
+        // move every buffered element into the main tier in one bulk append. Called
+        // automatically when the insert tier fills; calling it eagerly before a long
+        // pop-only phase removes the two-tier comparison from every pop.
+        void flush() {
+            if (insert_tier.empty()) {
+                return;
+            }
+
+            // the buffered elements are appended in one reservation and the heap
+            // property is recovered once, instead of one deep sift per element
+            main_tier.push_range(insert_tier.sort());
+        }
+
+        // add a new element. The push lands in the cache-resident insert tier in
+        // O(log(buffer_capacity)); the out-of-cache main tier is only touched by the
+        // amortized bulk flush.
+        void push(const T& element) {
+            insert_tier.push(element);
+
+            if (insert_tier.size() >= buffer_capacity) {
+                flush();
+            }
+        }
+
+        // return the top element of the heap (which must exist)
+        [[nodiscard]] const T& top() const {
+            assert(size() > 0);
+
+            return insert_tier_wins() ? insert_tier.top() : main_tier.top();
+        }
+
+        // remove the top element of the heap (which must exist)
+        void pop() {
+            assert(size() > 0);
+
+            if (insert_tier_wins()) {
+                insert_tier.pop();
+            } else {
+                main_tier.pop();
+            }
+        }
+
+        // remove the top element of the heap (which must exist) and return it
+        [[nodiscard]] T pop_top() {
+            assert(size() > 0);
+
+            return insert_tier_wins() ? insert_tier.pop_top() : main_tier.pop_top();
+        }
+    };
+
+    // create a two-tier Min Heap for out-of-cache sizes; buffer_capacity bounds the
+    // cache-resident insert tier (0 keeps the default)
+    template <typename T, std::size_t K = 16>
+    auto make_min_tiered_heap(const std::size_t buffer_capacity = 0) {
+        using tiered = TieredHeap<T, std::greater<T>, K>;
+        return buffer_capacity == 0 ? tiered(std::greater<T>{})
+                                    : tiered(std::greater<T>{}, buffer_capacity);
+    }
+
+    // create a two-tier Max Heap for out-of-cache sizes
+    template <typename T, std::size_t K = 16>
+    auto make_max_tiered_heap(const std::size_t buffer_capacity = 0) {
+        using tiered = TieredHeap<T, std::less<T>, K>;
+        return buffer_capacity == 0 ? tiered(std::less<T>{})
+                                    : tiered(std::less<T>{}, buffer_capacity);
+    }
+
+}  // namespace heap
+
+#endif  // TIERED_HEAP_H
@@ -0,0 +1,101 @@
+#include <algorithm>  // std::sort
+#include <vector>     // std::vector
+
+#include "gtest/gtest.h"
+#include "priority_queue/BoundedHeap.h"
+
+using namespace heap;
+
+class BoundedHeapTest : public ::testing::Test {
+protected:
+    BoundedHeapTest() {
+        std::sort(test_vector_sorted.begin(), test_vector_sorted.end());
+    }
+
+    std::vector<int> test_vector = {30, 1, 50, 20, 40, 60, 100, 5, 70, 2};
+    std::vector<int> test_vector_sorted = test_vector;
+
+    BoundedHeap<int, std::greater<int>> top3_heap = make_bounded_min_heap<int>(3);
+    BoundedHeap<int, std::less<int>> bottom3_heap = make_bounded_max_heap<int>(3);
+};
+
+TEST_F(BoundedHeapTest, WorksIfEmpty) {
+    ASSERT_TRUE(top3_heap.empty());
+    ASSERT_FALSE(top3_heap.full());
+    ASSERT_EQ(top3_heap.capacity(), 3);
+}
+
+TEST_F(BoundedHeapTest, FillsUpToCapacity) {
+    ASSERT_TRUE(top3_heap.push_if_better(30));
+    ASSERT_TRUE(top3_heap.push_if_better(1));
+    ASSERT_TRUE(top3_heap.push_if_better(50));
+
+    ASSERT_TRUE(top3_heap.full());
+    ASSERT_EQ(top3_heap.size(), 3);
+    ASSERT_EQ(top3_heap.top(), 1);
+}
+
+TEST_F(BoundedHeapTest, KeepsLargestElements) {
+    for (const auto& v : test_vector) {
+        top3_heap.push_if_better(v);
+    }
+
+    ASSERT_TRUE(top3_heap.full());
+    ASSERT_EQ(top3_heap.size(), 3);
+
+    // the 3 largest elements come out in ascending order
+    const auto n = test_vector_sorted.size();
+    for (std::size_t i = n - 3; i < n; ++i) {
+        ASSERT_EQ(top3_heap.top(), test_vector_sorted.at(i));
+        top3_heap.pop();
+    }
+
+    ASSERT_TRUE(top3_heap.empty());
+}
+
+TEST_F(BoundedHeapTest, KeepsSmallestElements) {
+    for (const auto& v : test_vector) {
+        bottom3_heap.push_if_better(v);
+    }
+
+    ASSERT_TRUE(bottom3_heap.full());
+    ASSERT_EQ(bottom3_heap.size(), 3);
+
+    // the 3 smallest elements come out in descending order
+    for (std::size_t i = 3; i-- > 0;) {
+        ASSERT_EQ(bottom3_heap.top(), test_vector_sorted.at(i));
+        bottom3_heap.pop();
+    }
+
+    ASSERT_TRUE(bottom3_heap.empty());
+}
+
+TEST_F(BoundedHeapTest, RejectsWorseElementsWhenFull) {
+    for (const auto& v : test_vector) {
+        top3_heap.push_if_better(v);
+    }
+
+    // everything smaller than the current root must be rejected without any change
+    ASSERT_FALSE(top3_heap.push_if_better(0));
+    ASSERT_FALSE(top3_heap.push_if_better(top3_heap.top()));
+    ASSERT_EQ(top3_heap.size(), 3);
+
+    // a better candidate evicts the root
+    ASSERT_TRUE(top3_heap.push_if_better(1000));
+    ASSERT_EQ(top3_heap.size(), 3);
+
+    const auto result = top3_heap.extract();
+    ASSERT_EQ(result.back(), 1000);
+}
+
+TEST_F(BoundedHeapTest, ExtractReturnsSortedElements) {
+    for (const auto& v : test_vector) {
+        top3_heap.push_if_better(v);
+    }
+
+    const auto result = top3_heap.extract();
+    const std::vector<int> expected = {60, 70, 100};
+
+    ASSERT_EQ(result, expected);
+    ASSERT_TRUE(top3_heap.empty());
+}
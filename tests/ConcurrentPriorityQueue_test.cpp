@@ -0,0 +1,107 @@
+#include <algorithm>  // std::sort
+#include <atomic>     // std::atomic
+#include <cstddef>    // std::size_t
+#include <mutex>      // std::mutex, std::lock_guard
+#include <thread>     // std::thread
+#include <vector>     // std::vector
+
+#include "gtest/gtest.h"
+#include "priority_queue/ConcurrentPriorityQueue.h"
+
+TEST(ConcurrentPriorityQueueTest, WorksIfEmpty) {
+    auto queue = concurrent::make_min_concurrent_priority_queue<int, int>(4);
+
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.size(), 0);
+    ASSERT_FALSE(queue.try_pop().has_value());
+    ASSERT_FALSE(queue.top().has_value());
+}
+
+TEST(ConcurrentPriorityQueueTest, SingleThreadedPushPop) {
+    auto queue = concurrent::make_min_concurrent_priority_queue<int, int>(4);
+
+    const std::vector<int> keys = {30, 1, 50, 20, 40, 60, 100, 5, 70, 2};
+    for (const int key : keys) {
+        queue.push(key, key * 10);
+    }
+
+    ASSERT_EQ(queue.size(), keys.size());
+
+    // the ordering is relaxed across sub-queues, but a single-threaded drain must
+    // return every pushed pair exactly once
+    std::vector<int> popped;
+    while (auto entry = queue.try_pop()) {
+        ASSERT_EQ(entry->second, entry->first * 10);
+        popped.push_back(entry->first);
+    }
+
+    std::sort(popped.begin(), popped.end());
+    std::vector<int> expected = keys;
+    std::sort(expected.begin(), expected.end());
+    ASSERT_EQ(popped, expected);
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(ConcurrentPriorityQueueTest, MultiThreadedDrainLosesNothing) {
+    constexpr std::size_t num_producers = 4;
+    constexpr std::size_t num_consumers = 4;
+    constexpr std::size_t pushes_per_producer = 5000;
+
+    auto queue = concurrent::make_min_concurrent_priority_queue<int, int>(
+        2 * (num_producers + num_consumers));
+
+    std::atomic<std::size_t> producers_done{0};
+    std::mutex popped_mutex;
+    std::vector<int> popped;
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_producers + num_consumers);
+
+    for (std::size_t p = 0; p < num_producers; ++p) {
+        threads.emplace_back([&queue, &producers_done, p] {
+            for (std::size_t i = 0; i < pushes_per_producer; ++i) {
+                const int key = static_cast<int>(p * pushes_per_producer + i);
+                queue.push(key, key);
+            }
+            producers_done.fetch_add(1);
+        });
+    }
+
+    for (std::size_t c = 0; c < num_consumers; ++c) {
+        threads.emplace_back([&queue, &producers_done, &popped_mutex, &popped] {
+            std::vector<int> local;
+
+            // keep draining until the producers are done and the queue stays empty;
+            // interleave top() probes so the snapshot path races with push/try_pop
+            while (true) {
+                if (const auto snapshot = queue.top()) {
+                    ASSERT_EQ(snapshot->first, snapshot->second);
+                }
+
+                if (auto entry = queue.try_pop()) {
+                    ASSERT_EQ(entry->first, entry->second);
+                    local.push_back(entry->first);
+                } else if (producers_done.load() == num_producers) {
+                    break;
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(popped_mutex);
+            popped.insert(popped.end(), local.begin(), local.end());
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // every pushed key comes out exactly once, across all consumers
+    ASSERT_EQ(popped.size(), num_producers * pushes_per_producer);
+    std::sort(popped.begin(), popped.end());
+    for (std::size_t i = 0; i < popped.size(); ++i) {
+        ASSERT_EQ(popped[i], static_cast<int>(i));
+    }
+
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.try_pop().has_value());
+}
@@ -0,0 +1,92 @@
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+#include "gtest/gtest.h"
+#include "priority_queue/HandlePriorityQueue.h"
+
+TEST(HandlePriorityQueueTest, PopsInKeyOrder) {
+    auto queue = priority_queue::make_min_handle_priority_queue<int, std::string>();
+
+    const auto turin = queue.push(40, "Turin");
+    const auto milan = queue.push(20, "Milan");
+    const auto venice = queue.push(30, "Venice");
+
+    ASSERT_EQ(queue.size(), 3);
+    ASSERT_TRUE(queue.valid(turin));
+    ASSERT_EQ(queue.key_at(venice), 30);
+    ASSERT_EQ(queue.element_at(milan), "Milan");
+    ASSERT_EQ(queue.top(), "Milan");
+
+    const auto [key, element] = queue.pop_top();
+    ASSERT_EQ(key, 20);
+    ASSERT_EQ(element, "Milan");
+    ASSERT_FALSE(queue.valid(milan));
+    ASSERT_EQ(queue.top(), "Venice");
+}
+
+TEST(HandlePriorityQueueTest, AllowsDuplicateElements) {
+    // the value-keyed PriorityQueue rejects duplicates; handles make them fine
+    auto queue = priority_queue::make_min_handle_priority_queue<int, std::string>();
+
+    const auto first = queue.push(20, "Turin");
+    const auto second = queue.push(10, "Turin");
+
+    ASSERT_NE(first, second);
+    ASSERT_EQ(queue.size(), 2);
+
+    queue.pop();
+    ASSERT_FALSE(queue.valid(second));
+    ASSERT_TRUE(queue.valid(first));
+    ASSERT_EQ(queue.key_at(first), 20);
+}
+
+TEST(HandlePriorityQueueTest, UpdateKeyWorksInBothDirections) {
+    auto queue = priority_queue::make_min_handle_k_priority_queue<4, int, std::string>();
+
+    const auto turin = queue.push(10, "Turin");
+    (void)queue.push(20, "Milan");
+    (void)queue.push(30, "Venice");
+
+    queue.update_key(turin, 100);
+    ASSERT_EQ(queue.top(), "Milan");
+
+    queue.update_key(turin, 1);
+    ASSERT_EQ(queue.top(), "Turin");
+    ASSERT_EQ(queue.key_at(turin), 1);
+}
+
+TEST(HandlePriorityQueueTest, RemoveInvalidatesOnlyThatHandle) {
+    auto queue = priority_queue::make_min_handle_priority_queue<int, std::string>();
+
+    const auto turin = queue.push(10, "Turin");
+    const auto milan = queue.push(20, "Milan");
+    const auto venice = queue.push(30, "Venice");
+
+    queue.remove(milan);
+
+    ASSERT_EQ(queue.size(), 2);
+    ASSERT_FALSE(queue.valid(milan));
+    ASSERT_TRUE(queue.valid(turin));
+    ASSERT_TRUE(queue.valid(venice));
+
+    const auto [k1, v1] = queue.pop_top();
+    ASSERT_EQ(k1, 10);
+    ASSERT_EQ(v1, "Turin");
+    const auto [k2, v2] = queue.pop_top();
+    ASSERT_EQ(k2, 30);
+    ASSERT_EQ(v2, "Venice");
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(HandlePriorityQueueTest, RecyclesFreedSlots) {
+    auto queue = priority_queue::make_min_handle_priority_queue<int, int>();
+
+    const auto first = queue.push(1, 100);
+    queue.remove(first);
+
+    // the freed slot is reused before the slot vector grows
+    const auto second = queue.push(2, 200);
+    ASSERT_EQ(second, first);
+    ASSERT_EQ(queue.element_at(second), 200);
+    ASSERT_EQ(queue.size(), 1);
+}
@@ -0,0 +1,105 @@
+#include <algorithm>  // std::min_element
+#include <cstddef>    // std::size_t
+#include <random>     // std::mt19937, std::uniform_int_distribution
+#include <vector>     // std::vector
+
+#include "gtest/gtest.h"
+#include "priority_queue/IndexedPriorityQueue.h"
+
+TEST(IndexedPriorityQueueTest, PopsInKeyOrder) {
+    auto queue = priority_queue::make_min_indexed_priority_queue<false, int, int>();
+
+    const std::vector<int> keys = {30, 1, 50, 20, 40};
+    for (std::size_t element = 0; element < keys.size(); ++element) {
+        queue.push(keys[element], static_cast<int>(element));
+    }
+
+    const auto [k1, v1] = queue.pop_top();
+    ASSERT_EQ(k1, 1);
+    ASSERT_EQ(v1, 1);
+    const auto [k2, v2] = queue.pop_top();
+    ASSERT_EQ(k2, 20);
+    ASSERT_EQ(v2, 3);
+}
+
+TEST(IndexedPriorityQueueTest, UpdateKeyDecreaseOnMinHeap) {
+    auto queue = priority_queue::make_min_indexed_priority_queue<false, int, int>();
+
+    queue.push(30, 0);
+    queue.push(20, 1);
+    queue.push(10, 2);
+
+    queue.update_key(5, 0);
+
+    ASSERT_EQ(queue.key_at(0), 5);
+    ASSERT_EQ(queue.top(), 0);
+}
+
+TEST(IndexedPriorityQueueTest, UpdateKeyIncreaseOnMinHeap) {
+    auto queue = priority_queue::make_min_indexed_priority_queue<false, int, int>();
+
+    queue.push(10, 0);
+    queue.push(20, 1);
+    queue.push(30, 2);
+
+    // increasing the top key must demote it below the elements it no longer beats
+    queue.update_key(100, 0);
+
+    const auto [k1, v1] = queue.pop_top();
+    ASSERT_EQ(k1, 20);
+    ASSERT_EQ(v1, 1);
+    const auto [k2, v2] = queue.pop_top();
+    ASSERT_EQ(k2, 30);
+    ASSERT_EQ(v2, 2);
+    const auto [k3, v3] = queue.pop_top();
+    ASSERT_EQ(k3, 100);
+    ASSERT_EQ(v3, 0);
+}
+
+TEST(IndexedPriorityQueueTest, UpdateKeyDecreaseOnMaxHeap) {
+    auto queue = priority_queue::make_max_indexed_priority_queue<false, int, int>();
+
+    queue.push(30, 0);
+    queue.push(20, 1);
+    queue.push(10, 2);
+
+    queue.update_key(1, 0);
+
+    const auto [k1, v1] = queue.pop_top();
+    ASSERT_EQ(k1, 20);
+    ASSERT_EQ(v1, 1);
+}
+
+TEST(IndexedPriorityQueueTest, RandomizedUpdatesAgainstReferenceModel) {
+    auto queue = priority_queue::make_min_indexed_k_priority_queue<4, false, int, int>();
+
+    constexpr std::size_t num_elements = 256;
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> key_distribution(0, 10000);
+
+    std::vector<int> model(num_elements);
+    for (std::size_t element = 0; element < num_elements; ++element) {
+        model[element] = key_distribution(generator);
+        queue.push(model[element], static_cast<int>(element));
+    }
+
+    // random updates in both directions, then a full drain checked against the model
+    for (std::size_t round = 0; round < 4 * num_elements; ++round) {
+        const auto element = static_cast<std::size_t>(
+            key_distribution(generator) % static_cast<int>(num_elements));
+        model[element] = key_distribution(generator);
+        queue.update_key(model[element], static_cast<int>(element));
+    }
+
+    std::size_t remaining = num_elements;
+    while (remaining > 0) {
+        const auto [key, element] = queue.pop_top();
+        ASSERT_EQ(key, model[static_cast<std::size_t>(element)]);
+        ASSERT_EQ(key, *std::min_element(model.begin(), model.end()));
+
+        model[static_cast<std::size_t>(element)] = 10001;
+        remaining--;
+    }
+
+    ASSERT_TRUE(queue.empty());
+}
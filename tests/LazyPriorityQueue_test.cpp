@@ -0,0 +1,82 @@
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+#include "gtest/gtest.h"
+#include "priority_queue/LazyPriorityQueue.h"
+
+TEST(LazyPriorityQueueTest, PopsInKeyOrder) {
+    auto queue = priority_queue::make_min_lazy_priority_queue<int, std::string>();
+
+    queue.push(40, "Turin");
+    queue.push(20, "Milan");
+    queue.push(30, "Venice");
+
+    ASSERT_EQ(queue.size(), 3);
+    ASSERT_EQ(queue.top(), "Milan");
+
+    const auto [key, element] = queue.pop_top();
+    ASSERT_EQ(key, 20);
+    ASSERT_EQ(element, "Milan");
+    ASSERT_EQ(queue.top(), "Venice");
+}
+
+TEST(LazyPriorityQueueTest, UpdateKeySupersedesTheOldEntry) {
+    auto queue = priority_queue::make_min_lazy_priority_queue<int, std::string>();
+
+    queue.push(10, "Turin");
+    queue.push(20, "Milan");
+
+    // both directions: the tombstoned versions must never surface
+    queue.update_key(100, "Turin");
+    ASSERT_EQ(queue.top(), "Milan");
+
+    queue.update_key(1, "Turin");
+    ASSERT_EQ(queue.top(), "Turin");
+    ASSERT_EQ(queue.key_at("Turin"), 1);
+    ASSERT_EQ(queue.size(), 2);
+}
+
+TEST(LazyPriorityQueueTest, RemoveTombstonesTheEntry) {
+    auto queue = priority_queue::make_min_lazy_k_priority_queue<4, int, std::string>();
+
+    queue.push(10, "Turin");
+    queue.push(20, "Milan");
+    queue.push(30, "Venice");
+
+    queue.remove("Turin");
+
+    ASSERT_EQ(queue.size(), 2);
+    ASSERT_FALSE(queue.contains("Turin"));
+    ASSERT_EQ(queue.top(), "Milan");
+
+    const auto [key, element] = queue.pop_top();
+    ASSERT_EQ(key, 20);
+    ASSERT_EQ(element, "Milan");
+}
+
+TEST(LazyPriorityQueueTest, SurvivesManyUpdatesAcrossCompactions) {
+    // a tiny dead ratio forces frequent compactions under churn
+    auto queue = priority_queue::make_min_lazy_priority_queue<int, int>(0.1);
+
+    constexpr int num_elements = 64;
+    for (int element = 0; element < num_elements; ++element) {
+        queue.push(element, element);
+    }
+
+    // re-key every element several times; only the last version may survive
+    for (int round = 0; round < 8; ++round) {
+        for (int element = 0; element < num_elements; ++element) {
+            queue.update_key(1000 - element, element);
+        }
+    }
+
+    ASSERT_EQ(queue.size(), num_elements);
+
+    for (int expected_key = 1000 - num_elements + 1; expected_key <= 1000; ++expected_key) {
+        const auto [key, element] = queue.pop_top();
+        ASSERT_EQ(key, expected_key);
+        ASSERT_EQ(element, 1000 - key);
+    }
+
+    ASSERT_TRUE(queue.empty());
+}
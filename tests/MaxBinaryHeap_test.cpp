@@ -16,11 +16,11 @@ protected:
     std::vector<int> test_vector = {30, 1, 50, 20, 40, 60, 100};
     std::vector<int> test_vector_sorted = test_vector;
 
-    BinaryHeap<int, false> empty_max_heap = make_max_heap<false, int>();
-    BinaryHeap<int, false> max_heap = make_max_heap<false, int>(test_vector);
+    BinaryHeap<int, false, std::less<int>> empty_max_heap = make_max_heap<false, int>();
+    BinaryHeap<int, false, std::less<int>> max_heap = make_max_heap<false, int>(test_vector);
 
     std::vector<int> already_max_seed = {8, 7, 6, 5, 4, 3, 2, 1, 0};
-    BinaryHeap<int, true> already_max_heap = make_max_heap<true, int>(already_max_seed);
+    BinaryHeap<int, true, std::less<int>> already_max_heap = make_max_heap<true, int>(already_max_seed);
 };
 
 TEST_F(BinaryMaxHeapTest, WorksIfEmpty) {
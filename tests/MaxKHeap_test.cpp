@@ -19,11 +19,11 @@ protected:
     std::vector<int> test_vector = {30, 1, 50, 20, 40, 60, 100};
     std::vector<int> test_vector_sorted = test_vector;
 
-    KHeap<4, int, false> empty_max_heap = make_max_k_heap<4, false, int>();
-    KHeap<4, int, false> max_heap = make_max_k_heap<4, false>(std::vector<int>(test_vector));
+    KHeap<4, int, false, std::less<int>> empty_max_heap = make_max_k_heap<4, false, int>();
+    KHeap<4, int, false, std::less<int>> max_heap = make_max_k_heap<4, false>(std::vector<int>(test_vector));
 
     std::vector<int> already_max_seed = {8, 7, 6, 5, 4, 3, 2, 1, 0};
-    KHeap<4, int, true> already_max_heap =
+    KHeap<4, int, true, std::less<int>> already_max_heap =
         make_max_k_heap<4, true>(std::vector<int>(already_max_seed));
 };
 
@@ -79,11 +79,11 @@ protected:
     std::vector<int> test_vector = {30, 1, 50, 20, 80, 60, 100};
     std::vector<int> test_vector_sorted = test_vector;
 
-    KHeap<8, int, false> empty_max_heap = make_max_k_heap<8, false, int>();
-    KHeap<8, int, false> max_heap = make_max_k_heap<8, false>(test_vector);
+    KHeap<8, int, false, std::less<int>> empty_max_heap = make_max_k_heap<8, false, int>();
+    KHeap<8, int, false, std::less<int>> max_heap = make_max_k_heap<8, false>(test_vector);
 
     std::vector<int> already_max_seed = {8, 7, 6, 5, 4, 3, 2, 1, 0};
-    KHeap<8, int, true> already_max_heap = make_max_k_heap<8, true>(already_max_seed);
+    KHeap<8, int, true, std::less<int>> already_max_heap = make_max_k_heap<8, true>(already_max_seed);
 };
 
 TEST_F(K8MaxHeapTest, WorksIfEmpty) {
@@ -1,4 +1,5 @@
 #include <algorithm>  // std::sort
+#include <utility>    // std::move
 #include <vector>     // std::vector
 
 #include "gtest/gtest.h"
@@ -51,6 +52,50 @@ TEST_F(BinaryMinHeapTest, WorksIfFull) {
     }
 }
 
+TEST_F(BinaryMinHeapTest, SortReturnsPopOrderAndEmptiesTheHeap) {
+    const auto sorted = min_heap.sort();
+
+    ASSERT_EQ(sorted, test_vector_sorted);
+    ASSERT_TRUE(min_heap.empty());
+
+    // the emptied heap stays usable
+    min_heap.push(7);
+    ASSERT_EQ(min_heap.top(), 7);
+}
+
+TEST_F(BinaryMinHeapTest, MeldAbsorbsTheOtherHeap) {
+    auto other = make_min_heap<false, int>({25, 3, 99});
+
+    min_heap.meld(std::move(other));
+
+    ASSERT_EQ(min_heap.size(), test_vector.size() + 3);
+    ASSERT_TRUE(other.empty());  // NOLINT: melding empties the source heap
+
+    std::vector<int> expected = test_vector;
+    expected.insert(expected.end(), {25, 3, 99});
+    std::sort(expected.begin(), expected.end());
+
+    for (const auto& v : expected) {
+        ASSERT_EQ(min_heap.top(), v);
+        min_heap.pop();
+    }
+}
+
+TEST_F(BinaryMinHeapTest, ReplaceTopKeepsTheHeapOrdered) {
+    // streaming pop-then-push: overwrite the root and sift once
+    min_heap.replace_top(35);
+
+    std::vector<int> expected = test_vector;
+    expected.erase(std::find(expected.begin(), expected.end(), 1));
+    expected.push_back(35);
+    std::sort(expected.begin(), expected.end());
+
+    for (const auto& v : expected) {
+        ASSERT_EQ(min_heap.top(), v);
+        min_heap.pop();
+    }
+}
+
 TEST_F(BinaryMinHeapTest, WorksIfAlreadyHeap) {
     ASSERT_FALSE(already_min_heap.empty());
     ASSERT_EQ(already_min_heap.size(), already_min_seed.size());
@@ -0,0 +1,288 @@
+#include <sstream>  // std::stringstream
+#include <string>   // std::string
+#include <utility>  // std::pair
+#include <vector>   // std::vector
+
+#include "gtest/gtest.h"
+#include "priority_queue/PriorityQueue.h"
+
+TEST(PriorityQueueTest, PopsInKeyOrder) {
+    auto queue = priority_queue::make_min_priority_queue<false, int, std::string>();
+
+    queue.push(40, "Turin");
+    queue.push(20, "Milan");
+    queue.push(30, "Venice");
+
+    ASSERT_EQ(queue.size(), 3);
+    ASSERT_EQ(queue.top(), "Milan");
+
+    const auto [key, element] = queue.pop_top();
+    ASSERT_EQ(key, 20);
+    ASSERT_EQ(element, "Milan");
+    ASSERT_EQ(queue.top(), "Venice");
+}
+
+TEST(PriorityQueueTest, DrainYieldsEveryPairInPopOrder) {
+    auto queue = priority_queue::make_min_k_priority_queue<4, false, int, std::string>();
+
+    queue.push(40, "Turin");
+    queue.push(20, "Milan");
+    queue.push(30, "Venice");
+    queue.push(10, "Rome");
+
+    std::vector<std::pair<int, std::string>> drained;
+    for (const auto& [key, element] : queue.drain()) {
+        drained.emplace_back(key, element);
+    }
+
+    const std::vector<std::pair<int, std::string>> expected = {
+        {10, "Rome"}, {20, "Milan"}, {30, "Venice"}, {40, "Turin"}};
+    ASSERT_EQ(drained, expected);
+
+    // the drain consumes the queue, which stays usable afterwards
+    ASSERT_TRUE(queue.empty());
+    queue.push(5, "Genoa");
+    ASSERT_EQ(queue.top(), "Genoa");
+}
+
+TEST(PriorityQueueTest, MeldAbsorbsADisjointQueue) {
+    auto queue = priority_queue::make_min_priority_queue<false, int, std::string>();
+    queue.push(40, "Turin");
+    queue.push(20, "Milan");
+
+    auto other = priority_queue::make_min_priority_queue<false, int, std::string>();
+    other.push(10, "Rome");
+    other.push(30, "Venice");
+
+    queue.meld(std::move(other));
+
+    ASSERT_EQ(queue.size(), 4);
+    ASSERT_TRUE(other.empty());  // NOLINT: melding empties the source queue
+
+    // melded entries keep their keys and take part in the ordering
+    ASSERT_TRUE(queue.contains("Rome"));
+    ASSERT_EQ(queue.key_at("Venice"), 30);
+
+    std::vector<std::pair<int, std::string>> drained;
+    for (const auto& [key, element] : queue.drain()) {
+        drained.emplace_back(key, element);
+    }
+
+    const std::vector<std::pair<int, std::string>> expected = {
+        {10, "Rome"}, {20, "Milan"}, {30, "Venice"}, {40, "Turin"}};
+    ASSERT_EQ(drained, expected);
+}
+
+TEST(PriorityQueueTest, StableModePopsEqualKeysInFifoOrder) {
+    auto queue = priority_queue::make_min_stable_priority_queue<false, int, std::string>();
+
+    queue.push(20, "first");
+    queue.push(10, "Rome");
+    queue.push(20, "second");
+    queue.push(20, "third");
+
+    std::vector<std::string> drained;
+    for (const auto& [key, element] : queue.drain()) {
+        drained.emplace_back(element);
+    }
+
+    // equal keys come out in enqueue order, not in whatever order the sifts left them
+    const std::vector<std::string> expected = {"Rome", "first", "second", "third"};
+    ASSERT_EQ(drained, expected);
+}
+
+TEST(PriorityQueueTest, StableModeRekeyingSendsTheElementToTheBackOfItsKey) {
+    auto queue = priority_queue::make_min_stable_priority_queue<false, int, std::string>();
+
+    queue.push(20, "first");
+    queue.push(20, "second");
+
+    // a re-keyed element gets a fresh FIFO stamp, even if the key doesn't change
+    queue.update_key(20, "first");
+
+    const auto [key, element] = queue.pop_top();
+    ASSERT_EQ(key, 20);
+    ASSERT_EQ(element, "second");
+}
+
+TEST(PriorityQueueTest, SerializeRoundTripRestoresTheQueue) {
+    auto queue = priority_queue::make_min_priority_queue<false, int, int>();
+
+    queue.push(40, 4);
+    queue.push(20, 2);
+    queue.push(30, 3);
+    queue.push(10, 1);
+
+    std::stringstream stream;
+    queue.serialize(stream);
+
+    auto loaded = priority_queue::load_min_priority_queue<int, int>(stream);
+    ASSERT_EQ(loaded.size(), 4);
+    ASSERT_EQ(loaded.key_at(3), 30);
+
+    // the loaded queue is fully functional, not just a frozen snapshot
+    loaded.update_key(5, 4);
+
+    std::vector<std::pair<int, int>> drained;
+    for (const auto& pair : loaded.drain()) {
+        drained.emplace_back(pair);
+    }
+
+    const std::vector<std::pair<int, int>> expected = {{5, 4}, {10, 1}, {20, 2}, {30, 3}};
+    ASSERT_EQ(drained, expected);
+}
+
+TEST(PriorityQueueTest, SerializeRoundTripThroughAKHeapQueue) {
+    auto queue = priority_queue::make_min_k_priority_queue<4, false, int, int>();
+
+    for (int key = 16; key > 0; --key) {
+        queue.push(key, key * 100);
+    }
+
+    std::stringstream stream;
+    queue.serialize(stream);
+
+    auto loaded = priority_queue::load_min_k_priority_queue<4, int, int>(stream);
+    ASSERT_EQ(loaded.size(), 16);
+
+    for (int key = 1; key <= 16; ++key) {
+        const auto [popped_key, element] = loaded.pop_top();
+        ASSERT_EQ(popped_key, key);
+        ASSERT_EQ(element, key * 100);
+    }
+}
+
+TEST(PriorityQueueTest, UpdateKeyWorksInBothDirections) {
+    auto queue = priority_queue::make_min_priority_queue<false, int, std::string>();
+
+    queue.push(10, "Turin");
+    queue.push(20, "Milan");
+    queue.push(30, "Venice");
+
+    // increasing the top key on a min-queue must demote it
+    queue.update_key(100, "Turin");
+    ASSERT_EQ(queue.top(), "Milan");
+
+    // decreasing brings it back
+    queue.update_key(1, "Turin");
+    ASSERT_EQ(queue.top(), "Turin");
+    ASSERT_EQ(queue.key_at("Turin"), 1);
+}
+
+TEST(PriorityQueueTest, RemoveErasesFromAnyPosition) {
+    auto queue = priority_queue::make_min_priority_queue<false, int, std::string>();
+
+    queue.push(10, "Turin");
+    queue.push(20, "Milan");
+    queue.push(30, "Venice");
+    queue.push(40, "Rome");
+
+    // remove an inner element, then the top
+    queue.remove("Milan");
+    ASSERT_EQ(queue.size(), 3);
+    ASSERT_FALSE(queue.contains("Milan"));
+
+    queue.remove("Turin");
+    ASSERT_EQ(queue.top(), "Venice");
+
+    std::vector<std::pair<int, std::string>> drained;
+    for (const auto& [key, element] : queue.drain()) {
+        drained.emplace_back(key, element);
+    }
+
+    const std::vector<std::pair<int, std::string>> expected = {{30, "Venice"}, {40, "Rome"}};
+    ASSERT_EQ(drained, expected);
+}
+
+TEST(PriorityQueueTest, RemoveTheLastElementLeavesAnEmptyQueue) {
+    auto queue = priority_queue::make_min_priority_queue<false, int, std::string>();
+
+    queue.push(10, "Turin");
+    queue.remove("Turin");
+
+    ASSERT_TRUE(queue.empty());
+    queue.push(5, "Genoa");
+    ASSERT_EQ(queue.top(), "Genoa");
+}
+
+TEST(PriorityQueueTest, ReplaceTopReturnsTheOldPair) {
+    auto queue = priority_queue::make_min_priority_queue<false, int, std::string>();
+
+    queue.push(10, "Turin");
+    queue.push(20, "Milan");
+    queue.push(30, "Venice");
+
+    const auto [old_key, old_element] = queue.replace_top(25, "Rome");
+    ASSERT_EQ(old_key, 10);
+    ASSERT_EQ(old_element, "Turin");
+
+    // the replacement took the popped entry's place in the ordering and the maps
+    ASSERT_EQ(queue.size(), 3);
+    ASSERT_FALSE(queue.contains("Turin"));
+    ASSERT_EQ(queue.key_at("Rome"), 25);
+
+    std::vector<std::pair<int, std::string>> drained;
+    for (const auto& [key, element] : queue.drain()) {
+        drained.emplace_back(key, element);
+    }
+
+    const std::vector<std::pair<int, std::string>> expected = {
+        {20, "Milan"}, {25, "Rome"}, {30, "Venice"}};
+    ASSERT_EQ(drained, expected);
+}
+
+TEST(PriorityQueueTest, TopKReturnsPopOrderWithoutMutating) {
+    auto queue = priority_queue::make_min_priority_queue<false, int, std::string>();
+
+    queue.push(40, "Turin");
+    queue.push(20, "Milan");
+    queue.push(30, "Venice");
+    queue.push(10, "Rome");
+
+    const auto best = queue.top_k(3);
+
+    const std::vector<std::pair<int, std::string>> expected = {
+        {10, "Rome"}, {20, "Milan"}, {30, "Venice"}};
+    ASSERT_EQ(best, expected);
+
+    // the queue is untouched
+    ASSERT_EQ(queue.size(), 4);
+    ASSERT_EQ(queue.top(), "Rome");
+
+    // k past the size clamps to a full snapshot
+    ASSERT_EQ(queue.top_k(100).size(), 4);
+    ASSERT_TRUE(queue.top_k(0).empty());
+}
+
+TEST(PriorityQueueTest, PopKRemovesTheBestKPairs) {
+    auto queue = priority_queue::make_min_k_priority_queue<4, false, int, int>();
+
+    for (int key = 32; key > 0; --key) {
+        queue.push(key, key * 100);
+    }
+
+    const auto popped = queue.pop_k(5);
+
+    ASSERT_EQ(popped.size(), 5);
+    for (int key = 1; key <= 5; ++key) {
+        ASSERT_EQ(popped[static_cast<std::size_t>(key - 1)].first, key);
+        ASSERT_FALSE(queue.contains(key * 100));
+    }
+
+    // the remaining queue is still a valid heap with consistent maps
+    ASSERT_EQ(queue.size(), 27);
+    for (int key = 6; key <= 32; ++key) {
+        const auto [popped_key, element] = queue.pop_top();
+        ASSERT_EQ(popped_key, key);
+        ASSERT_EQ(element, key * 100);
+    }
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(PriorityQueueTest, DrainOfAnEmptyQueueIsAnEmptyRange) {
+    auto queue = priority_queue::make_min_priority_queue<false, int, std::string>();
+
+    for ([[maybe_unused]] const auto& pair : queue.drain()) {
+        FAIL() << "an empty queue must drain zero pairs";
+    }
+}
@@ -0,0 +1,99 @@
+#include <algorithm>  // std::sort
+#include <cstdint>    // std::uint32_t
+#include <string>     // std::string
+#include <vector>     // std::vector
+
+#include "gtest/gtest.h"
+#include "priority_queue/RadixHeap.h"
+
+using namespace heap;
+
+class RadixHeapTest : public ::testing::Test {
+protected:
+    RadixHeapTest() {
+        std::sort(test_vector_sorted.begin(), test_vector_sorted.end());
+    }
+
+    std::vector<std::uint32_t> test_vector = {30, 1, 50, 20, 40, 60, 100, 5, 70, 2};
+    std::vector<std::uint32_t> test_vector_sorted = test_vector;
+
+    RadixHeap<std::uint32_t, std::uint32_t> radix_heap =
+        priority_queue::make_min_radix_priority_queue<std::uint32_t, std::uint32_t>();
+};
+
+TEST_F(RadixHeapTest, WorksIfEmpty) {
+    ASSERT_TRUE(radix_heap.empty());
+    ASSERT_EQ(radix_heap.size(), 0);
+}
+
+TEST_F(RadixHeapTest, PopsInKeyOrder) {
+    for (const auto& v : test_vector) {
+        radix_heap.push(v, v);
+    }
+
+    ASSERT_FALSE(radix_heap.empty());
+    ASSERT_EQ(radix_heap.size(), test_vector.size());
+
+    for (const auto& v : test_vector_sorted) {
+        const auto x = radix_heap.top();
+        ASSERT_EQ(x, v);
+        radix_heap.pop();
+    }
+
+    ASSERT_TRUE(radix_heap.empty());
+}
+
+TEST_F(RadixHeapTest, TopKeyValueReturnsKeyElementPair) {
+    auto city_heap = priority_queue::make_min_radix_priority_queue<std::uint32_t, std::string>();
+
+    city_heap.push(40, "Turin");
+    city_heap.push(20, "Milan");
+    city_heap.push(30, "Venice");
+
+    const auto& [key, city] = city_heap.top_key_value();
+    ASSERT_EQ(key, 20);
+    ASSERT_EQ(city, "Milan");
+
+    const auto [popped_key, popped_city] = city_heap.pop_top();
+    ASSERT_EQ(popped_key, 20);
+    ASSERT_EQ(popped_city, "Milan");
+    ASSERT_EQ(city_heap.size(), 2);
+}
+
+TEST_F(RadixHeapTest, AllowsMonotonePushesBetweenPops) {
+    // Dijkstra-like usage: pushed keys never fall below the last popped key
+    radix_heap.push(10, 10);
+    radix_heap.push(25, 25);
+
+    auto [k1, v1] = radix_heap.pop_top();
+    ASSERT_EQ(k1, 10);
+
+    radix_heap.push(12, 12);
+    radix_heap.push(10, 10);
+
+    auto [k2, v2] = radix_heap.pop_top();
+    ASSERT_EQ(k2, 10);
+    auto [k3, v3] = radix_heap.pop_top();
+    ASSERT_EQ(k3, 12);
+    auto [k4, v4] = radix_heap.pop_top();
+    ASSERT_EQ(k4, 25);
+
+    ASSERT_TRUE(radix_heap.empty());
+}
+
+TEST_F(RadixHeapTest, HandlesDuplicateKeys) {
+    radix_heap.push(7, 1);
+    radix_heap.push(7, 2);
+    radix_heap.push(7, 3);
+
+    std::vector<std::uint32_t> popped;
+    while (!radix_heap.empty()) {
+        const auto [key, value] = radix_heap.pop_top();
+        ASSERT_EQ(key, 7);
+        popped.push_back(value);
+    }
+
+    std::sort(popped.begin(), popped.end());
+    const std::vector<std::uint32_t> expected = {1, 2, 3};
+    ASSERT_EQ(popped, expected);
+}
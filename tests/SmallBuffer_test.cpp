@@ -0,0 +1,176 @@
+#include <sstream>    // std::stringstream
+#include <stdexcept>  // std::out_of_range
+#include <string>     // std::string, std::to_string
+#include <utility>    // std::move
+#include <vector>     // std::vector
+
+#include "gtest/gtest.h"
+#include "priority_queue/PriorityQueue.h"
+#include "priority_queue/SmallBuffer.h"
+
+using heap::detail::small_vector;
+using priority_queue::detail::flat_map;
+
+TEST(SmallVectorTest, StaysInlineBelowCapacity) {
+    small_vector<int, 8> vec;
+
+    ASSERT_TRUE(vec.empty());
+    ASSERT_EQ(vec.capacity(), 8);
+
+    for (int i = 0; i < 8; ++i) {
+        vec.push_back(i);
+    }
+
+    // filling up to InlineCapacity must not spill to the allocator
+    ASSERT_EQ(vec.size(), 8);
+    ASSERT_EQ(vec.capacity(), 8);
+
+    for (int i = 0; i < 8; ++i) {
+        ASSERT_EQ(vec[static_cast<std::size_t>(i)], i);
+    }
+}
+
+TEST(SmallVectorTest, SpillsPastInlineCapacityAndKeepsElements) {
+    small_vector<std::string, 4> vec;
+
+    for (int i = 0; i < 100; ++i) {
+        vec.emplace_back(std::to_string(i));
+    }
+
+    ASSERT_EQ(vec.size(), 100);
+    ASSERT_GT(vec.capacity(), 4);
+
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(vec[static_cast<std::size_t>(i)], std::to_string(i));
+    }
+}
+
+TEST(SmallVectorTest, DataIsContiguousInlineAndSpilled) {
+    small_vector<int, 4> vec;
+
+    for (int i = 0; i < 4; ++i) {
+        vec.push_back(i);
+    }
+
+    // data() must view the same storage as the iterators, inline...
+    ASSERT_EQ(vec.data(), vec.begin());
+    ASSERT_EQ(vec.data()[2], 2);
+
+    for (int i = 4; i < 32; ++i) {
+        vec.push_back(i);
+    }
+
+    // ...and after the spill
+    ASSERT_EQ(vec.data(), vec.begin());
+    for (int i = 0; i < 32; ++i) {
+        ASSERT_EQ(vec.data()[i], i);
+    }
+
+    const auto& const_vec = vec;
+    ASSERT_EQ(const_vec.data(), const_vec.begin());
+}
+
+TEST(SmallVectorTest, InsertAndErase) {
+    small_vector<int, 4> vec;
+    const std::vector<int> head = {1, 2, 3};
+    const std::vector<int> tail = {7, 8, 9};
+
+    vec.insert(vec.end(), head.begin(), head.end());
+    vec.insert(vec.end(), tail.begin(), tail.end());
+    vec.insert(vec.begin() + 3, 2, 5);
+
+    const std::vector<int> expected = {1, 2, 3, 5, 5, 7, 8, 9};
+    ASSERT_TRUE(std::equal(vec.begin(), vec.end(), expected.begin(), expected.end()));
+
+    vec.erase(vec.begin() + 3, vec.begin() + 5);
+
+    const std::vector<int> after_erase = {1, 2, 3, 7, 8, 9};
+    ASSERT_TRUE(std::equal(vec.begin(), vec.end(), after_erase.begin(), after_erase.end()));
+}
+
+TEST(SmallVectorTest, CopyAndMoveAcrossTheSpillBoundary) {
+    small_vector<std::string, 2> inline_vec;
+    inline_vec.emplace_back("a");
+    inline_vec.emplace_back("b");
+
+    small_vector<std::string, 2> inline_copy = inline_vec;
+    ASSERT_EQ(inline_copy.size(), 2);
+    ASSERT_EQ(inline_copy[0], "a");
+
+    small_vector<std::string, 2> spilled_vec;
+    for (int i = 0; i < 10; ++i) {
+        spilled_vec.emplace_back(std::to_string(i));
+    }
+
+    small_vector<std::string, 2> spilled_moved = std::move(spilled_vec);
+    ASSERT_EQ(spilled_moved.size(), 10);
+    ASSERT_EQ(spilled_moved[9], "9");
+    ASSERT_TRUE(spilled_vec.empty());  // NOLINT: moved-from state is specified here
+}
+
+TEST(SmallVectorTest, AtThrowsOutOfRange) {
+    small_vector<int, 4> vec;
+    vec.push_back(42);
+
+    ASSERT_EQ(vec.at(0), 42);
+    ASSERT_THROW((void)vec.at(1), std::out_of_range);
+}
+
+TEST(FlatMapTest, InsertFindErase) {
+    flat_map<int, std::string, 4> map;
+
+    map[1] = "one";
+    map[2] = "two";
+    map[3] = "three";
+
+    ASSERT_EQ(map.size(), 3);
+    ASSERT_EQ(map.count(2), 1);
+    ASSERT_EQ(map.count(9), 0);
+    ASSERT_EQ(map.at(3), "three");
+    ASSERT_THROW((void)map.at(9), std::out_of_range);
+
+    // swap-with-back erase keeps the other entries reachable
+    ASSERT_EQ(map.erase(2), 1);
+    ASSERT_EQ(map.erase(2), 0);
+    ASSERT_EQ(map.size(), 2);
+    ASSERT_EQ(map.at(1), "one");
+    ASSERT_EQ(map.at(3), "three");
+}
+
+TEST(FlatMapTest, MergeMirrorsUnorderedMapSemantics) {
+    flat_map<int, std::string, 4> map;
+    map[1] = "one";
+    map[2] = "two";
+
+    flat_map<int, std::string, 4> other;
+    other[2] = "TWO";
+    other[3] = "three";
+
+    map.merge(std::move(other));
+
+    // non-colliding entries move over, colliding ones stay in other
+    ASSERT_EQ(map.size(), 3);
+    ASSERT_EQ(map.at(2), "two");
+    ASSERT_EQ(map.at(3), "three");
+    ASSERT_EQ(other.size(), 1);
+    ASSERT_EQ(other.at(2), "TWO");
+}
+
+TEST(SmallBufferTest, SmallPriorityQueueSerializeRoundTrip) {
+    auto small_queue = priority_queue::make_min_small_priority_queue<8, int, int>();
+
+    small_queue.push(30, 300);
+    small_queue.push(10, 100);
+    small_queue.push(20, 200);
+
+    // serialize() reads this->nodes.data(), which must exist in small-buffer mode too
+    std::stringstream stream;
+    small_queue.serialize(stream);
+
+    auto loaded = priority_queue::load_min_priority_queue<int, int>(stream);
+    ASSERT_EQ(loaded.size(), 3);
+
+    const auto [key, element] = loaded.pop_top();
+    ASSERT_EQ(key, 10);
+    ASSERT_EQ(element, 100);
+}
@@ -0,0 +1,77 @@
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+#include "gtest/gtest.h"
+#include "priority_queue/SoAPriorityQueue.h"
+
+TEST(SoAPriorityQueueTest, PopsInKeyOrder) {
+    auto queue = priority_queue::make_min_soa_priority_queue<false, int, std::string>();
+
+    queue.push(40, "Turin");
+    queue.push(20, "Milan");
+    queue.push(30, "Venice");
+
+    ASSERT_EQ(queue.size(), 3);
+    ASSERT_EQ(queue.top(), "Milan");
+    ASSERT_EQ(queue.top_key(), 20);
+
+    const auto [k1, v1] = queue.pop_top();
+    ASSERT_EQ(k1, 20);
+    ASSERT_EQ(v1, "Milan");
+    const auto [k2, v2] = queue.pop_top();
+    ASSERT_EQ(k2, 30);
+    ASSERT_EQ(v2, "Venice");
+    const auto [k3, v3] = queue.pop_top();
+    ASSERT_EQ(k3, 40);
+    ASSERT_EQ(v3, "Turin");
+
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(SoAPriorityQueueTest, UpdateKeyDecreaseOnMinHeap) {
+    auto queue = priority_queue::make_min_soa_priority_queue<false, int, std::string>();
+
+    queue.push(40, "Turin");
+    queue.push(20, "Milan");
+    queue.push(30, "Venice");
+
+    queue.update_key(10, "Turin");
+
+    ASSERT_EQ(queue.key_at("Turin"), 10);
+    ASSERT_EQ(queue.top(), "Turin");
+}
+
+TEST(SoAPriorityQueueTest, UpdateKeyIncreaseOnMinHeap) {
+    auto queue = priority_queue::make_min_soa_priority_queue<false, int, std::string>();
+
+    queue.push(10, "Turin");
+    queue.push(20, "Milan");
+    queue.push(30, "Venice");
+
+    // increasing the top key must demote it below the elements it no longer beats
+    queue.update_key(100, "Turin");
+
+    const auto [k1, v1] = queue.pop_top();
+    ASSERT_EQ(k1, 20);
+    ASSERT_EQ(v1, "Milan");
+    const auto [k2, v2] = queue.pop_top();
+    ASSERT_EQ(k2, 30);
+    ASSERT_EQ(v2, "Venice");
+    const auto [k3, v3] = queue.pop_top();
+    ASSERT_EQ(k3, 100);
+    ASSERT_EQ(v3, "Turin");
+}
+
+TEST(SoAPriorityQueueTest, UpdateKeyDecreaseOnMaxHeap) {
+    auto queue = priority_queue::make_max_soa_k_priority_queue<4, false, int, std::string>();
+
+    queue.push(40, "Turin");
+    queue.push(20, "Milan");
+    queue.push(30, "Venice");
+
+    queue.update_key(1, "Turin");
+
+    const auto [key, element] = queue.pop_top();
+    ASSERT_EQ(key, 30);
+    ASSERT_EQ(element, "Venice");
+}
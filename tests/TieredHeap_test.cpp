@@ -0,0 +1,90 @@
+#include <algorithm>  // std::sort
+#include <cstddef>    // std::size_t
+#include <random>     // std::mt19937, std::uniform_int_distribution
+#include <vector>     // std::vector
+
+#include "gtest/gtest.h"
+#include "priority_queue/TieredHeap.h"
+
+TEST(TieredHeapTest, WorksIfEmpty) {
+    auto tiered = heap::make_min_tiered_heap<int>();
+
+    ASSERT_TRUE(tiered.empty());
+    ASSERT_EQ(tiered.size(), 0);
+}
+
+TEST(TieredHeapTest, PopsInOrderAcrossFlushBoundaries) {
+    // a tiny insert tier forces several bulk flushes into the main tier
+    auto tiered = heap::make_min_tiered_heap<int>(8);
+
+    std::vector<int> inputs;
+    for (int v = 100; v > 0; --v) {
+        inputs.push_back(v);
+        tiered.push(v);
+    }
+
+    ASSERT_EQ(tiered.size(), inputs.size());
+
+    std::sort(inputs.begin(), inputs.end());
+    for (const int v : inputs) {
+        ASSERT_EQ(tiered.top(), v);
+        ASSERT_EQ(tiered.pop_top(), v);
+    }
+
+    ASSERT_TRUE(tiered.empty());
+}
+
+TEST(TieredHeapTest, TopPicksTheBetterTier) {
+    auto tiered = heap::make_min_tiered_heap<int>(4);
+
+    // fill and flush the insert tier, then push a better element that stays buffered
+    for (int v = 10; v < 14; ++v) {
+        tiered.push(v);
+    }
+    tiered.push(1);
+
+    ASSERT_EQ(tiered.top(), 1);
+    ASSERT_EQ(tiered.pop_top(), 1);
+    ASSERT_EQ(tiered.top(), 10);
+}
+
+TEST(TieredHeapTest, EagerFlushPreservesTheContents) {
+    auto tiered = heap::make_max_tiered_heap<int>(16);
+
+    for (int v = 0; v < 10; ++v) {
+        tiered.push(v);
+    }
+
+    tiered.flush();
+
+    ASSERT_EQ(tiered.size(), 10);
+    for (int v = 9; v >= 0; --v) {
+        ASSERT_EQ(tiered.pop_top(), v);
+    }
+}
+
+TEST(TieredHeapTest, RandomizedInterleavedPushPop) {
+    auto tiered = heap::make_min_tiered_heap<int, 8>(16);
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> value_distribution(0, 10000);
+
+    std::vector<int> reference;
+    for (std::size_t round = 0; round < 2000; ++round) {
+        if (reference.empty() || value_distribution(generator) % 3 != 0) {
+            const int value = value_distribution(generator);
+            reference.push_back(value);
+            tiered.push(value);
+        } else {
+            const auto best = std::min_element(reference.begin(), reference.end());
+            ASSERT_EQ(tiered.pop_top(), *best);
+            reference.erase(best);
+        }
+    }
+
+    std::sort(reference.begin(), reference.end());
+    for (const int v : reference) {
+        ASSERT_EQ(tiered.pop_top(), v);
+    }
+    ASSERT_TRUE(tiered.empty());
+}
@@ -2,3 +2,20 @@ COPTS = select({
     "@bazel_tools//src/conditions:windows": ["/std:c++17", "/W4", "/Oi", "/Ot", "/WX"],
     "//conditions:default": ["-std=c++17", "-O3", "-Wall", "-Wextra"],
 })
+
+# append to COPTS for debug/sanitizer builds to restore bounds-checked node access
+# on the heap hot paths, e.g.:
+#   bazel build -c dbg --copt=-DHEAP_CHECKED_ACCESS //...
+CHECKED_ACCESS_COPTS = select({
+    "@bazel_tools//src/conditions:windows": ["/DHEAP_CHECKED_ACCESS"],
+    "//conditions:default": ["-DHEAP_CHECKED_ACCESS"],
+})
+
+# append to COPTS to collect the operation counters and sift-depth histograms
+# exposed by stats() (see stats_t in Heap.h); off by default, so release builds
+# pay nothing, e.g.:
+#   bazel build --copt=-DHEAP_STATS //...
+STATS_COPTS = select({
+    "@bazel_tools//src/conditions:windows": ["/DHEAP_STATS"],
+    "//conditions:default": ["-DHEAP_STATS"],
+})